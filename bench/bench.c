@@ -0,0 +1,1366 @@
+/**
+ * @file bench.c
+ *
+ * @brief Benchmarks of the loading, scaling and drawing paths
+ *
+ * A private Xvfb server is started for the benchmarks that need a
+ * display; the others (file parsing, scaling, composition in memory and
+ * drag replay) run without it.  Results are written as JSON to the
+ * standard output, with percentiles, so that runs of different versions
+ * can be compared.
+ */
+/*
+ * ISC License
+ * Copyright (c) 2025, J. A. Corbal <jacorbal@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS.  IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS
+ * ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF
+ * THIS SOFTWARE.
+ */
+
+/* Enable features from the POSIX.1-2008 standard */
+#define _POSIX_C_SOURCE 200809L
+
+/* Standard library includes */
+#include <ctype.h>      /* tolower */
+#include <dirent.h>     /* closedir, opendir, readdir */
+#include <fcntl.h>      /* O_WRONLY, open */
+#include <getopt.h>     /* getopt, optarg */
+#include <poll.h>       /* poll, pollfd, POLLIN */
+#include <signal.h>     /* SIGTERM, kill */
+#include <stdint.h>     /* uint32_t */
+#include <stdio.h>      /* FILE, fgets, fopen, fprintf, snprintf, ... */
+#include <stdlib.h>     /* atoi, free, mkdtemp, qsort, realloc, ... */
+#include <string.h>     /* memset, strcmp, strcspn, strlen, strncmp, ... */
+#include <sys/stat.h>   /* S_ISDIR, stat */
+#include <sys/types.h>  /* pid_t */
+#include <sys/wait.h>   /* waitpid */
+#include <time.h>       /* clock_gettime, timespec */
+#include <unistd.h>     /* _exit, close, dup2, execlp, fork, read, ... */
+
+/* X includes */
+#include <X11/Xlib.h>       /* Display, Window, XEvent, X* */
+#include <X11/Xlibint.h>    /* GetReq, LockDisplay, _XReply, _XRead */
+#include <X11/Xutil.h>      /* XClassHint, XDestroyImage, ... */
+#include <X11/xpm.h>        /* XpmReadFileToImage, XpmReadFileToXpmImage */
+#include <X11/extensions/XResproto.h>   /* X-Resource requests */
+
+/* Local includes */
+#include <backend.h>
+#include <compose.h>
+#include <defaults.h>
+#include <drag.h>
+#include <iconify.h>
+#include <imgfile.h>
+#include <pixbuf.h>
+#include <pyramid.h>
+#include <scale.h>
+#include <trace.h>
+
+
+/* Most files benchmarked, and longest path */
+#define BENCH_MAX_FILES (64)
+#define BENCH_MAX_PATH (4096)
+
+/* Most windows queried at once */
+#define BENCH_MAX_WINDOWS (64)
+
+/* Pixels of the reference decoding, as libXpm and libX11 give them */
+#define BENCH_PIXEL_TRANSPARENT (0x00FFFFFFu)
+#define BENCH_PIXEL_BLACK (0xFF000000u)
+#define BENCH_PIXEL_WHITE (0xFFFFFFFFu)
+
+/* Seconds to wait for Xvfb to start */
+#define BENCH_XVFB_TIMEOUT (10)
+
+/* Most round trips to iconify a window (class hint, position, and the
+ * atoms once per display) and to restore it, image transfers aside */
+#define BENCH_ICONIFY_ROUND_TRIPS (3)
+#define BENCH_RESTORE_ROUND_TRIPS (0)
+
+
+/**
+ * @typedef samples_td
+ *
+ * @brief Times measured by a benchmark (us)
+ */
+typedef struct {
+    double *values;         /**< Times */
+    size_t count;           /**< Number of times */
+    size_t capacity;        /**< Room for times */
+    unsigned long requests; /**< X requests sent, over every time */
+} samples_td;
+
+
+/**
+ * @typedef resources_td
+ *
+ * @brief Resources a client holds on the server
+ */
+typedef struct {
+    unsigned long windows;  /**< Windows */
+    unsigned long pixmaps;  /**< Pixmaps */
+    unsigned long gcs;      /**< Graphics contexts */
+} resources_td;
+
+
+/**
+ * @typedef golden_td
+ *
+ * @brief Icon window checked against a reference image
+ */
+typedef struct {
+    const char *file;           /**< Icon file, in the images directory */
+    unsigned int size;          /**< Icon width and height (px) */
+    scale_filter_td filter;     /**< Scaling filter */
+    const char *caption;        /**< Name below the icon, or no caption */
+    const char *reference;      /**< PPM file, in 'golden/' */
+} golden_td;
+
+
+/* Color databases of the X server, the first one found is used */
+static const char *_rgb_paths[] = {
+    "/usr/share/X11/rgb.txt", "/etc/X11/rgb.txt", "/usr/lib/X11/rgb.txt"
+};
+
+
+/* Icon windows rendered as references: downscaled, upscaled, every
+ * filter, and captions that fit, are cut, are empty or are not shown */
+static const golden_td _golden[] = {
+    { "xpm/X11.xpm", 48, SCALE_BOX, "X11", "X11-48-box" },
+    { "xpm/X11_64x64.xpm", 64, SCALE_NEAREST,
+        "a name too long for the icon", "X11_64x64-64-nearest-long" },
+    { "xpm/X11_16x16.xpm", 40, SCALE_BILINEAR, "",
+        "X11_16x16-40-bilinear-empty" },
+    { "xbm/X11_32x32.xbm", 32, SCALE_NEAREST, NULL,
+        "X11_32x32-32-nearest-none" },
+    { "default.xpm", 96, SCALE_BILINEAR, "iconify", "default-96-bilinear" }
+};
+
+
+/* Output state: iterations per benchmark, whether a result was already
+ * written, and whether a check failed (resources leaked, budget
+ * exceeded) */
+static int _iterations = 100;
+static Bool _first = True;
+static Bool _failed = False;
+
+/* Whether the reference images are written instead of checked */
+static Bool _golden_update = False;
+
+
+/* Current monotonic time (us) */
+static double _now(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (double) now.tv_sec * 1e6 + (double) now.tv_nsec / 1e3;
+}
+
+
+/* Add a time to the samples */
+static void _sample_add(samples_td *samples, double value)
+{
+    if (samples->count == samples->capacity) {
+        size_t capacity = (samples->capacity) ? 2 * samples->capacity : 64;
+        double *values = realloc(samples->values,
+                capacity * sizeof(*values));
+        if (!values) {
+            return;
+        }
+        samples->values = values;
+        samples->capacity = capacity;
+    }
+    samples->values[samples->count++] = value;
+}
+
+
+/* Order of two times, for sorting */
+static int _sample_compare(const void *a, const void *b)
+{
+    double x = *(const double *) a, y = *(const double *) b;
+    return (x > y) - (x < y);
+}
+
+
+/* Percentile of sorted samples, by nearest rank */
+static double _percentile(const samples_td *samples, double p)
+{
+    size_t rank = (size_t) (p / 100.0 * (double) samples->count + 0.5);
+    rank = (rank < 1) ? 1 : (rank > samples->count) ? samples->count : rank;
+    return samples->values[rank - 1];
+}
+
+
+/* Write the result of a benchmark, and release its samples */
+static void _result_write(const char *name, samples_td *samples)
+{
+    if (samples->count == 0) {
+        free(samples->values);
+        return;
+    }
+
+    double sum = 0;
+    for (size_t i = 0; i < samples->count; ++i) {
+        sum += samples->values[i];
+    }
+    qsort(samples->values, samples->count, sizeof(double),
+            _sample_compare);
+
+    printf("%s\n    {\"name\": \"%s\", \"unit\": \"us\", \"count\": %zu, "
+            "\"mean\": %.2f, \"min\": %.2f, \"p50\": %.2f, "
+            "\"p90\": %.2f, \"p99\": %.2f, \"max\": %.2f, "
+            "\"requests\": %.1f}",
+            (_first) ? "" : ",", name, samples->count,
+            sum / (double) samples->count, samples->values[0],
+            _percentile(samples, 50), _percentile(samples, 90),
+            _percentile(samples, 99), samples->values[samples->count - 1],
+            (double) samples->requests / (double) samples->count);
+    fprintf(stderr, "%-40s p50 %10.2f us  p99 %10.2f us\n", name,
+            _percentile(samples, 50), _percentile(samples, 99));
+    _first = False;
+
+    free(samples->values);
+    memset(samples, 0, sizeof(*samples));
+}
+
+
+/* Write the resources left by a benchmark, which should be none */
+static void _leaks_write(const char *name, const resources_td *before,
+        const resources_td *after)
+{
+    long windows = (long) after->windows - (long) before->windows;
+    long pixmaps = (long) after->pixmaps - (long) before->pixmaps;
+    long gcs = (long) after->gcs - (long) before->gcs;
+
+    printf("%s\n    {\"name\": \"%s\", \"unit\": \"resources\", "
+            "\"windows\": %ld, \"pixmaps\": %ld, \"gcs\": %ld}",
+            (_first) ? "" : ",", name, windows, pixmaps, gcs);
+    fprintf(stderr, "%-40s windows %ld  pixmaps %ld  gcs %ld\n", name,
+            windows, pixmaps, gcs);
+    _first = False;
+    if (windows != 0 || pixmaps != 0 || gcs != 0) {
+        _failed = True;
+    }
+}
+
+
+/* Write the most round trips a phase took, which may not exceed its
+ * budget */
+static void _budget_write(const char *name, unsigned long long most,
+        unsigned long long budget)
+{
+    printf("%s\n    {\"name\": \"%s\", \"unit\": \"round trips\", "
+            "\"max\": %llu, \"budget\": %llu}",
+            (_first) ? "" : ",", name, most, budget);
+    fprintf(stderr, "%-40s max %llu  budget %llu%s\n", name, most, budget,
+            (most > budget) ? "  EXCEEDED" : "");
+    _first = False;
+    if (most > budget) {
+        _failed = True;
+    }
+}
+
+
+/* Write the pixels of an image that differ from its reference, which
+ * should be none */
+static void _differences_write(const char *name, unsigned long count)
+{
+    printf("%s\n    {\"name\": \"%s\", \"unit\": \"pixels\", "
+            "\"different\": %lu}", (_first) ? "" : ",", name, count);
+    fprintf(stderr, "%-40s different %lu\n", name, count);
+    _first = False;
+    if (count != 0) {
+        _failed = True;
+    }
+}
+
+
+/* Find the icon files of a directory and of its subdirectories */
+static size_t _files_find(const char *dir, char files[][BENCH_MAX_PATH],
+        size_t count)
+{
+    DIR *d = opendir(dir);
+    struct dirent *entry;
+    struct stat st;
+
+    if (!d) {
+        return count;
+    }
+    while ((entry = readdir(d)) && count < BENCH_MAX_FILES) {
+        char path[BENCH_MAX_PATH];
+        const char *dot = strrchr(entry->d_name, '.');
+        if (entry->d_name[0] == '.' ||
+                snprintf(path, sizeof(path), "%s/%s", dir, entry->d_name)
+                    >= (int) sizeof(path) ||
+                stat(path, &st) != 0) {
+            continue;
+        }
+        if (S_ISDIR(st.st_mode)) {
+            count = _files_find(path, files, count);
+        } else if (dot && (strcmp(dot, ".xpm") == 0 ||
+                    strcmp(dot, ".xbm") == 0)) {
+            snprintf(files[count++], BENCH_MAX_PATH, "%s", path);
+        }
+    }
+    closedir(d);
+
+    return count;
+}
+
+
+/* Name of a benchmark on a file: the file name, without the directory
+ * of the images */
+static const char *_file_name(const char *path, const char *dir)
+{
+    size_t length = strlen(dir);
+    return (strncmp(path, dir, length) == 0 && path[length] == '/') ?
+        path + length + 1 : path;
+}
+
+
+/* Whether a file has an extension */
+static Bool _file_is(const char *path, const char *extension)
+{
+    const char *dot = strrchr(path, '.');
+    return dot && strcmp(dot, extension) == 0;
+}
+
+
+/* Whether two files have the same name, but for their directory and
+ * their extension */
+static Bool _file_twins(const char *a, const char *b)
+{
+    const char *slash_a = strrchr(a, '/'), *slash_b = strrchr(b, '/');
+    a = (slash_a) ? slash_a + 1 : a;
+    b = (slash_b) ? slash_b + 1 : b;
+    size_t length_a = strcspn(a, "."), length_b = strcspn(b, ".");
+    return length_a == length_b && strncmp(a, b, length_a) == 0;
+}
+
+
+/* Lowercase copy of a color name, without blanks */
+static void _color_key(const char *name, char *key, size_t size)
+{
+    size_t length = 0;
+
+    for (; *name && length + 1 < size; ++name) {
+        if (!isspace((unsigned char) *name)) {
+            key[length++] = (char) tolower((unsigned char) *name);
+        }
+    }
+    key[length] = '\0';
+}
+
+
+/* Look a color name up in the color database of the X server */
+static Bool _rgb_lookup(const char *name, uint32_t *rgb)
+{
+    char key[64], entry[64], line[256];
+    unsigned int red, green, blue;
+    int offset;
+
+    _color_key(name, key, sizeof(key));
+    for (size_t i = 0; i < sizeof(_rgb_paths) / sizeof(*_rgb_paths); ++i) {
+        FILE *fp = fopen(_rgb_paths[i], "r");
+        if (!fp) {
+            continue;
+        }
+        while (fgets(line, sizeof(line), fp)) {
+            if (sscanf(line, "%u %u %u %n", &red, &green, &blue,
+                        &offset) != 3) {
+                continue;   /* Comments start with '!' */
+            }
+            _color_key(line + offset, entry, sizeof(entry));
+            if (strcmp(entry, key) == 0) {
+                *rgb = (red & 0xFF) << 16 | (green & 0xFF) << 8 |
+                    (blue & 0xFF);
+                fclose(fp);
+                return True;
+            }
+        }
+        fclose(fp);
+        break;
+    }
+
+    return False;
+}
+
+
+/* Pixel of an XPM color, as the X server resolves it: hexadecimal
+ * digits are aligned to the left of 16 bits per channel, and names are
+ * looked up in its database */
+static Bool _reference_color(const char *value, uint32_t *argb)
+{
+    char key[8];
+    uint32_t rgb = 0;
+
+    _color_key(value, key, sizeof(key));
+    if (strcmp(key, "none") == 0) {
+        *argb = BENCH_PIXEL_TRANSPARENT;
+        return True;
+    }
+    if (value[0] == '#') {
+        size_t digits = strlen(value + 1);
+        size_t per_channel = digits / 3;
+        if (digits % 3 != 0 || per_channel < 1 || per_channel > 4 ||
+                strspn(value + 1, "0123456789abcdefABCDEF") != digits) {
+            return False;
+        }
+        for (size_t channel = 0; channel < 3; ++channel) {
+            char hex[5];
+            snprintf(hex, sizeof(hex), "%.*s", (int) per_channel,
+                    value + 1 + channel * per_channel);
+            unsigned long component = strtoul(hex, NULL, 16) <<
+                (16 - 4 * per_channel);
+            rgb = (rgb << 8) | (uint32_t) (component >> 8);
+        }
+    } else if (!_rgb_lookup(value, &rgb)) {
+        return False;
+    }
+    *argb = 0xFF000000u | rgb;
+
+    return True;
+}
+
+
+/* Decode an XPM file through libXpm, which needs no display to parse */
+static pixbuf_td *_reference_xpm(const char *path)
+{
+    XpmImage image;
+    uint32_t *colors = NULL;
+    pixbuf_td *pixbuf = NULL;
+
+    if (XpmReadFileToXpmImage(path, &image, NULL) != XpmSuccess) {
+        return NULL;
+    }
+
+    /* Preferred visual: color, then grayscale, then monochrome */
+    Bool resolved = (colors = calloc(image.ncolors, sizeof(*colors))) != NULL;
+    for (unsigned int i = 0; resolved && i < image.ncolors; ++i) {
+        const XpmColor *color = &image.colorTable[i];
+        const char *value = (color->c_color) ? color->c_color :
+            (color->g_color) ? color->g_color :
+            (color->g4_color) ? color->g4_color : color->m_color;
+        resolved = value && _reference_color(value, &colors[i]);
+    }
+    if (resolved && (pixbuf = pixbuf_new(image.width, image.height))) {
+        for (size_t i = 0; i < (size_t) image.width * image.height; ++i) {
+            pixbuf->data[i] = colors[image.data[i]];
+        }
+    }
+    free(colors);
+    XpmFreeXpmImage(&image);
+
+    return pixbuf;
+}
+
+
+/* Decode an XBM file through libX11, which needs no display to parse */
+static pixbuf_td *_reference_xbm(const char *path)
+{
+    unsigned int width, height;
+    unsigned char *data;
+    int x_hot, y_hot;
+
+    if (XReadBitmapFileData(path, &width, &height, &data, &x_hot,
+                &y_hot) != BitmapSuccess) {
+        return NULL;
+    }
+    pixbuf_td *pixbuf = pixbuf_new(width, height);
+    size_t stride = (width + 7) / 8;
+    for (unsigned int y = 0; pixbuf && y < height; ++y) {
+        for (unsigned int x = 0; x < width; ++x) {
+            pixbuf->data[(size_t) y * width + x] =
+                ((data[y * stride + x / 8] >> (x % 8)) & 1) ?
+                BENCH_PIXEL_BLACK : BENCH_PIXEL_WHITE;
+        }
+    }
+    XFree(data);
+
+    return pixbuf;
+}
+
+
+/* Read a PPM file, as 'compose_write' writes them, opaque */
+static pixbuf_td *_reference_ppm(const char *path)
+{
+    unsigned int width, height, maxval;
+
+    FILE *fp = fopen(path, "rb");
+    if (!fp) {
+        return NULL;
+    }
+    pixbuf_td *pixbuf = NULL;
+    if (fscanf(fp, "P6 %u %u %u", &width, &height, &maxval) == 3 &&
+            maxval == 255 && fgetc(fp) == '\n') {
+        pixbuf = pixbuf_new(width, height);
+    }
+    for (size_t i = 0; pixbuf && i < (size_t) width * height; ++i) {
+        unsigned char rgb[3];
+        if (fread(rgb, 1, sizeof(rgb), fp) != sizeof(rgb)) {
+            pixbuf_destroy(pixbuf);
+            pixbuf = NULL;
+            break;
+        }
+        pixbuf->data[i] = BENCH_PIXEL_BLACK |
+            ((uint32_t) rgb[0] << 16) | ((uint32_t) rgb[1] << 8) | rgb[2];
+    }
+    fclose(fp);
+
+    return pixbuf;
+}
+
+
+/* Pixels that differ between two images; every pixel, if only one of
+ * them could be read, or if their sizes differ */
+static unsigned long _pixels_differ(const pixbuf_td *a, const pixbuf_td *b)
+{
+    unsigned long area_a = (a) ? (unsigned long) a->width * a->height : 0;
+    unsigned long area_b = (b) ? (unsigned long) b->width * b->height : 0;
+    unsigned long count = 0;
+
+    if (!a || !b || a->width != b->width || a->height != b->height) {
+        return (area_a > area_b) ? area_a : area_b;
+    }
+    for (unsigned long i = 0; i < area_a; ++i) {
+        count += (a->data[i] != b->data[i]);
+    }
+
+    return count;
+}
+
+
+/* Correctness of the native parser: every file decodes as libXpm or
+ * libX11 decode it, and an XPM file as the XBM file of the same name */
+static void _check_imgfile(const char *dir, char files[][BENCH_MAX_PATH],
+        size_t count)
+{
+    char name[2 * BENCH_MAX_PATH + 64];
+
+    for (size_t f = 0; f < count; ++f) {
+        pixbuf_td *native = imgfile_read(files[f]);
+        pixbuf_td *reference = (_file_is(files[f], ".xpm")) ?
+            _reference_xpm(files[f]) : _reference_xbm(files[f]);
+        snprintf(name, sizeof(name), "imgfile_check/%s",
+                _file_name(files[f], dir));
+        _differences_write(name, _pixels_differ(native, reference));
+        pixbuf_destroy(reference);
+
+        for (size_t g = 0; _file_is(files[f], ".xpm") && g < count; ++g) {
+            if (!_file_is(files[g], ".xbm") ||
+                    !_file_twins(files[f], files[g])) {
+                continue;
+            }
+            pixbuf_td *twin = imgfile_read(files[g]);
+            snprintf(name, sizeof(name), "imgfile_check/%s=%s",
+                    _file_name(files[f], dir), _file_name(files[g], dir));
+            _differences_write(name, _pixels_differ(native, twin));
+            pixbuf_destroy(twin);
+        }
+        pixbuf_destroy(native);
+    }
+}
+
+
+/* Correctness of the composition: every icon window is rendered as
+ * '-o' renders it, and compared with its reference image, or written
+ * as the new reference */
+static void _check_golden(const char *dir)
+{
+    char path[BENCH_MAX_PATH];
+    char name[BENCH_MAX_PATH];
+
+    for (size_t g = 0; g < sizeof(_golden) / sizeof(*_golden); ++g) {
+        const golden_td *golden = &_golden[g];
+        icon_td icon;
+        memset(&icon, 0, sizeof(icon));
+        icon.prog_name = (char *) ((golden->caption) ? golden->caption : "");
+        icon.border = DEFAULT_BORDER;
+        icon.width = icon.height = golden->size;
+        icon.bg = DEFAULT_TEXT_BG;
+        icon.fg = DEFAULT_TEXT_FG;
+        icon.fc = DEFAULT_TEXT_FC;
+        icon.show_text = (golden->caption != NULL);
+        icon.filter = golden->filter;
+
+        snprintf(path, sizeof(path), "%s/%s", dir, golden->file);
+        pixbuf_td *pixbuf = NULL;
+        pyramid_td *pyramid = pyramid_load(path);
+        if (pyramid) {
+            pixbuf = compose_icon(&icon,
+                    pyramid_level(pyramid, icon.width, icon.height));
+            pyramid_destroy(pyramid);
+        }
+
+        /* A PPM file keeps no alpha */
+        for (size_t i = 0; pixbuf &&
+                i < (size_t) pixbuf->width * pixbuf->height; ++i) {
+            pixbuf->data[i] |= BENCH_PIXEL_BLACK;
+        }
+
+        snprintf(path, sizeof(path), "%s/golden/%s.ppm", dir,
+                golden->reference);
+        if (_golden_update) {
+            if (!pixbuf || compose_write(pixbuf, path) != 0) {
+                fprintf(stderr, "Error: could not write '%s'\n", path);
+                _failed = True;
+            }
+        } else {
+            pixbuf_td *reference = _reference_ppm(path);
+            snprintf(name, sizeof(name), "compose_check/%s",
+                    golden->reference);
+            _differences_write(name, _pixels_differ(pixbuf, reference));
+            pixbuf_destroy(reference);
+        }
+        pixbuf_destroy(pixbuf);
+    }
+}
+
+
+/* Synthetic image, with a gradient and a transparent corner */
+static pixbuf_td *_pixbuf_synthetic(unsigned int width, unsigned int height)
+{
+    pixbuf_td *pixbuf = pixbuf_new(width, height);
+    if (!pixbuf) {
+        return NULL;
+    }
+    for (unsigned int y = 0; y < height; ++y) {
+        for (unsigned int x = 0; x < width; ++x) {
+            uint32_t alpha = (x < width / 4 && y < height / 4) ? 0 : 0xFF;
+            pixbuf->data[(size_t) y * width + x] = (alpha << 24) |
+                ((x * 255 / width) << 16) | ((y * 255 / height) << 8) |
+                ((x ^ y) & 0xFF);
+        }
+    }
+
+    return pixbuf;
+}
+
+
+/* Benchmarks without a display: parsing, scaling and composition */
+static void _bench_memory(const char *dir, char files[][BENCH_MAX_PATH],
+        size_t count)
+{
+    static const unsigned int sizes[] = { 16, 32, 64, 128, 256 };
+    static const char *filters[] = { "nearest", "bilinear", "box" };
+    samples_td samples;
+    char name[BENCH_MAX_PATH + 64];
+
+    memset(&samples, 0, sizeof(samples));
+    _check_imgfile(dir, files, count);
+    _check_golden(dir);
+
+    /* Native XPM/XBM parser */
+    for (size_t f = 0; f < count; ++f) {
+        for (int i = 0; i < _iterations; ++i) {
+            double start = _now();
+            pixbuf_td *pixbuf = imgfile_read(files[f]);
+            _sample_add(&samples, _now() - start);
+            pixbuf_destroy(pixbuf);
+        }
+        snprintf(name, sizeof(name), "imgfile_read/%s",
+                _file_name(files[f], dir));
+        _result_write(name, &samples);
+    }
+
+    /* Scaling in memory, from a large image to every icon size */
+    pixbuf_td *large = _pixbuf_synthetic(1024, 768);
+    for (int filter = SCALE_NEAREST; large && filter <= SCALE_BOX;
+            ++filter) {
+        for (size_t s = 0; s < sizeof(sizes) / sizeof(*sizes); ++s) {
+            for (int i = 0; i < _iterations; ++i) {
+                double start = _now();
+                pixbuf_td *scaled = pixbuf_scale(large, sizes[s], sizes[s],
+                        (scale_filter_td) filter);
+                _sample_add(&samples, _now() - start);
+                pixbuf_destroy(scaled);
+            }
+            snprintf(name, sizeof(name), "pixbuf_scale/%s/1024x768-%u",
+                    filters[filter], sizes[s]);
+            _result_write(name, &samples);
+        }
+    }
+    pixbuf_destroy(large);
+
+    /* Whole icon window, composed in memory */
+    pixbuf_td *image = _pixbuf_synthetic(64, 64);
+    for (size_t s = 0; image && s < sizeof(sizes) / sizeof(*sizes); ++s) {
+        icon_td icon;
+        memset(&icon, 0, sizeof(icon));
+        icon.prog_name = (char *) "benchmark";
+        icon.border = 1;
+        icon.width = icon.height = sizes[s];
+        icon.bg = 0xFFFFFF;
+        icon.show_text = True;
+        icon.filter = SCALE_BOX;
+        for (int i = 0; i < _iterations; ++i) {
+            double start = _now();
+            pixbuf_td *pixbuf = compose_icon(&icon, image);
+            _sample_add(&samples, _now() - start);
+            pixbuf_destroy(pixbuf);
+        }
+        snprintf(name, sizeof(name), "compose_icon/64-%u", sizes[s]);
+        _result_write(name, &samples);
+    }
+    pixbuf_destroy(image);
+}
+
+
+/* Replay a 1000 Hz pointer through the drag pacing, as the event loop
+ * would: the latency is the time from every motion until the icon is
+ * moved to it, or to a later one, and the requests are the moves */
+static void _bench_drag(void)
+{
+    const long long step = 1000;                /* 1000 Hz (us) */
+    const long long start = 1000000, end = 3000000;     /* 2 s (us) */
+    samples_td samples;
+    drag_td drag;
+    long long pending_since = -1;   /* Oldest motion not shown yet */
+    long long now = start, next = start;
+    unsigned long moves = 0;
+    int x, y;
+
+    memset(&samples, 0, sizeof(samples));
+    drag_init(&drag, DEFAULT_DRAG_RATE);
+    drag_start(&drag, 0, 0);
+    while (now < end) {
+        /* Motion events, every millisecond, along a zigzag path */
+        if (now == next) {
+            long long t = next / step;
+            if (drag_motion(&drag, (int) (t % 400), (int) (t * 7 % 300)) &&
+                    pending_since < 0) {
+                pending_since = now;
+            }
+            next += step;
+        }
+        /* Every due move is a request, and shows all the motions since
+         * the previous one */
+        if (drag_step(&drag, now, &x, &y)) {
+            for (long long t = pending_since; t <= now; t += step) {
+                _sample_add(&samples, (double) (now - t));
+            }
+            pending_since = -1;
+            ++moves;
+        }
+        /* Sleep until the next motion or the next due move */
+        int timeout = drag_timeout(&drag, now);
+        long long wake = (timeout < 0) ? next : now + timeout * 1000;
+        now = (wake < next) ? wake : next;
+    }
+
+    /* Requests of the whole replay, not per motion */
+    samples.requests = moves * samples.count;
+    fprintf(stderr, "drag_replay: %lld motions, %lu moves\n",
+            (end - start) / step, moves);
+    _result_write("drag_replay/1000hz-2s", &samples);
+}
+
+
+/* Start a private Xvfb server; returns its process, and its display
+ * name in the buffer */
+static pid_t _xvfb_start(char *display_name, size_t size)
+{
+    int fds[2];
+    char fd[16], number[16];
+    struct pollfd wait_fd;
+
+    if (pipe(fds) != 0) {
+        return -1;
+    }
+    pid_t pid = fork();
+    if (pid == 0) {
+        int null = open("/dev/null", O_WRONLY);
+        dup2(null, 1);
+        dup2(null, 2);
+        close(fds[0]);
+        snprintf(fd, sizeof(fd), "%d", fds[1]);
+        execlp("Xvfb", "Xvfb", "-displayfd", fd, "-screen", "0",
+                "1920x1080x24", "-nolisten", "tcp", "-noreset",
+                (char *) NULL);
+        _exit(127);
+    }
+    close(fds[1]);
+    if (pid < 0) {
+        close(fds[0]);
+        return -1;
+    }
+
+    /* The server writes its display number once it is ready */
+    wait_fd.fd = fds[0];
+    wait_fd.events = POLLIN;
+    ssize_t length = 0;
+    if (poll(&wait_fd, 1, BENCH_XVFB_TIMEOUT * 1000) > 0) {
+        length = read(fds[0], number, sizeof(number) - 1);
+    }
+    close(fds[0]);
+    if (length <= 0) {
+        kill(pid, SIGTERM);
+        waitpid(pid, NULL, 0);
+        return -1;
+    }
+    number[length] = '\0';
+    number[strcspn(number, "\n")] = '\0';
+    snprintf(display_name, size, ":%s", number);
+
+    return pid;
+}
+
+
+/* Remove the files of the cache directory */
+static void _cache_clear(const char *dir)
+{
+    DIR *d = opendir(dir);
+    struct dirent *entry;
+    char path[BENCH_MAX_PATH];
+
+    if (!d) {
+        return;
+    }
+    while ((entry = readdir(d))) {
+        if (entry->d_name[0] != '.' &&
+                snprintf(path, sizeof(path), "%s/%s", dir, entry->d_name)
+                    < (int) sizeof(path)) {
+            unlink(path);
+        }
+    }
+    closedir(d);
+}
+
+
+/* Create an icon for a test window, without showing it */
+static icon_td *_icon_new(Display *display, Window window, const char *path,
+        unsigned int size)
+{
+    return icon_init(display, window, "benchmark", path, 1, size, size,
+            0xFFFFFF, 0x000000, 0x000000, True);
+}
+
+
+/* Count the resources this client holds, through the X-Resource
+ * extension; libXRes is not needed for a single request ('GetReq' wants
+ * the display as 'dpy') */
+static Bool _resources_count(Display *dpy, resources_td *resources)
+{
+    xXResQueryClientResourcesReq *request;
+    xXResQueryClientResourcesReply reply;
+    int opcode, event_base, error_base;
+
+    if (!XQueryExtension(dpy, XRES_NAME, &opcode, &event_base,
+                &error_base)) {
+        return False;
+    }
+    Atom window = XInternAtom(dpy, "WINDOW", False);
+    Atom pixmap = XInternAtom(dpy, "PIXMAP", False);
+    Atom gc = XInternAtom(dpy, "GC", False);
+    memset(resources, 0, sizeof(*resources));
+
+    LockDisplay(dpy);
+    GetReq(XResQueryClientResources, request);
+    request->reqType = (CARD8) opcode;
+    request->XResReqType = X_XResQueryClientResources;
+    request->xid = (CARD32) dpy->resource_base;
+    if (!_XReply(dpy, (xReply *) &reply, 0, xFalse)) {
+        UnlockDisplay(dpy);
+        SyncHandle();
+        return False;
+    }
+    for (CARD32 i = 0; i < reply.num_types; ++i) {
+        xXResType type;
+        _XRead(dpy, (char *) &type, sz_xXResType);
+        if (type.resource_type == window) {
+            resources->windows = type.count;
+        } else if (type.resource_type == pixmap) {
+            resources->pixmaps = type.count;
+        } else if (type.resource_type == gc) {
+            resources->gcs = type.count;
+        }
+    }
+    UnlockDisplay(dpy);
+    SyncHandle();
+
+    return True;
+}
+
+
+/* Questions about windows of an application, one and a batch at once:
+ * one after the other with Xlib, pipelined with XCB; runs of 'make
+ * bench' and 'make BACKEND=xcb bench' compare both */
+static void _bench_window_info(Display *display)
+{
+    static const unsigned int counts[] = { 1, BENCH_MAX_WINDOWS };
+    Window windows[BENCH_MAX_WINDOWS];
+    window_info_td infos[BENCH_MAX_WINDOWS];
+    XClassHint class_hint;
+    samples_td samples;
+    char name[64];
+
+    memset(&samples, 0, sizeof(samples));
+    class_hint.res_name = (char *) "benchmark";
+    class_hint.res_class = (char *) "Benchmark";
+    for (unsigned int i = 0; i < BENCH_MAX_WINDOWS; ++i) {
+        windows[i] = XCreateSimpleWindow(display,
+                DefaultRootWindow(display), (int) (i % 8) * 100,
+                (int) (i / 8) * 100, 80, 80, 0, 0, WhitePixel(display, 0));
+        XSetClassHint(display, windows[i], &class_hint);
+        XMapWindow(display, windows[i]);
+    }
+    XSync(display, False);
+
+    for (size_t c = 0; c < sizeof(counts) / sizeof(*counts); ++c) {
+        for (int i = 0; i < _iterations; ++i) {
+            unsigned long first = NextRequest(display);
+            double start = _now();
+            window_info_get_all(display, windows, counts[c], NULL,
+                    infos);
+            _sample_add(&samples, _now() - start);
+            samples.requests += NextRequest(display) - first;
+            for (unsigned int w = 0; w < counts[c]; ++w) {
+                window_info_free(&infos[w]);
+            }
+        }
+        snprintf(name, sizeof(name), "window_info/%u", counts[c]);
+        _result_write(name, &samples);
+    }
+
+    for (unsigned int i = 0; i < BENCH_MAX_WINDOWS; ++i) {
+        XDestroyWindow(display, windows[i]);
+    }
+    XSync(display, False);
+}
+
+
+/* Round trips counted so far by the phases of iconifying a window */
+static unsigned long long _iconify_round_trips(void)
+{
+    return trace_stats(TRACE_INIT)->round_trips +
+        trace_stats(TRACE_LOAD)->round_trips +
+        trace_stats(TRACE_CREATE)->round_trips;
+}
+
+
+/* Round trips of every iconify and restore, against their budgets; the
+ * icon is shared with one already shown, so that no image is sent, and
+ * what is paid once per display is paid by the benchmarks before */
+static void _bench_round_trips(Display *display, const char *path)
+{
+    unsigned long long iconify_most = 0, restore_most = 0;
+    XEvent event;
+
+    Window window = XCreateSimpleWindow(display, DefaultRootWindow(display),
+            100, 100, 640, 480, 0, 0, WhitePixel(display, 0));
+    XMapWindow(display, window);
+    XSync(display, False);
+
+    icon_td *shown = _icon_new(display, window, path, 48);
+    if (!trace_round_trips_counted()) {
+        fprintf(stderr, "Round trips are not counted by this build: "
+                "not checked\n");
+        icon_destroy(shown);
+        XDestroyWindow(display, window);
+        XSync(display, False);
+        return;
+    }
+    if (!shown || icon_load(shown) == None) {
+        fprintf(stderr, "No icon to iconify: round trips not checked\n");
+        icon_destroy(shown);
+        XDestroyWindow(display, window);
+        XSync(display, False);
+        return;
+    }
+
+    for (int i = 0; i < _iterations; ++i) {
+        XSync(display, False);
+        unsigned long long before = _iconify_round_trips();
+        icon_td *icon = _icon_new(display, window, path, 48);
+        if (!icon || icon_load(icon) == None) {
+            icon_destroy(icon);
+            continue;
+        }
+        icon_create(icon);
+        unsigned long long iconify = _iconify_round_trips() - before;
+
+        XSync(display, False);
+        before = trace_stats(TRACE_RESTORE)->round_trips;
+        window_restore(icon);
+        unsigned long long restore =
+            trace_stats(TRACE_RESTORE)->round_trips - before;
+
+        XSync(display, False);
+        while (XPending(display)) {
+            XNextEvent(display, &event);
+        }
+        icon_destroy(icon);
+        iconify_most = (iconify > iconify_most) ? iconify : iconify_most;
+        restore_most = (restore > restore_most) ? restore : restore_most;
+    }
+    _budget_write("round_trips/iconify", iconify_most,
+            BENCH_ICONIFY_ROUND_TRIPS);
+    _budget_write("round_trips/restore", restore_most,
+            BENCH_RESTORE_ROUND_TRIPS);
+
+    icon_destroy(shown);
+    XDestroyWindow(display, window);
+    XSync(display, False);
+}
+
+
+/* Soak: iconify a window and let it go, over and over, half of the
+ * times by destroying it and half by mapping it again from elsewhere;
+ * nothing may be left on the server */
+static void _bench_soak(Display *display, const char *path)
+{
+    resources_td before, after;
+    samples_td samples;
+    char name[64];
+    int cycles = 20 * _iterations;
+
+    memset(&samples, 0, sizeof(samples));
+    XSync(display, False);
+    Bool counted = _resources_count(display, &before);
+
+    for (int i = 0; i < cycles; ++i) {
+        Bool destroy = (i % 2 == 0);
+        Window window = XCreateSimpleWindow(display,
+                DefaultRootWindow(display), 100, 100, 320, 240, 0, 0,
+                WhitePixel(display, 0));
+        XMapWindow(display, window);
+        unsigned long first = NextRequest(display);
+        double start = _now();
+        icon_td *icon = _icon_new(display, window, path, 48);
+        if (icon && icon_load(icon) != None) {
+            icon_create(icon);
+
+            /* The application quits, or the window manager restores it */
+            if (destroy) {
+                XDestroyWindow(display, window);
+            } else {
+                XUnmapWindow(display, window);
+                XMapWindow(display, window);
+            }
+            XEvent event;
+            do {
+                XNextEvent(display, &event);
+            } while (!icon_event(icon, &event));
+        } else if (destroy) {
+            XDestroyWindow(display, window);
+        }
+        icon_destroy(icon);
+        if (!destroy) {
+            XDestroyWindow(display, window);
+        }
+        XSync(display, False);
+        _sample_add(&samples, _now() - start);
+        samples.requests += NextRequest(display) - first;
+    }
+    snprintf(name, sizeof(name), "soak/%d", cycles);
+    _result_write(name, &samples);
+
+    /* Shared pixmaps and the rest are all released by now */
+    XSync(display, False);
+    if (counted && _resources_count(display, &after)) {
+        snprintf(name, sizeof(name), "soak/%d/leaks", cycles);
+        _leaks_write(name, &before, &after);
+    } else {
+        fprintf(stderr, "X-Resource is not available: leaks not checked\n");
+    }
+}
+
+
+/* Benchmarks on a display: loading, scaling, drawing and restoring */
+static void _bench_display(Display *display, const char *dir,
+        char files[][BENCH_MAX_PATH], size_t count, const char *cache)
+{
+    static const unsigned int sizes[] = { 16, 32, 64, 128, 256 };
+    static const char *filters[] = { "nearest", "bilinear", "box" };
+    char cache_dir[BENCH_MAX_PATH];
+    char name[BENCH_MAX_PATH + 64];
+    samples_td samples;
+    XpmAttributes attributes;
+
+    memset(&samples, 0, sizeof(samples));
+    snprintf(cache_dir, sizeof(cache_dir), "%s/iconify", cache);
+
+    /* Original window, mapped as an application window would be */
+    Window window = XCreateSimpleWindow(display, DefaultRootWindow(display),
+            100, 100, 640, 480, 0, 0, WhitePixel(display, 0));
+    XSelectInput(display, window, StructureNotifyMask);
+    XMapWindow(display, window);
+    XSync(display, False);
+
+    for (size_t f = 0; f < count; ++f) {
+        const char *file = _file_name(files[f], dir);
+
+        /* libXpm, as the fallback of the native parser */
+        for (int i = 0; i < _iterations; ++i) {
+            XImage *image = NULL;
+            attributes.valuemask = 0;
+            double start = _now();
+            if (XpmReadFileToImage(display, files[f], &image, NULL,
+                        &attributes) == XpmSuccess) {
+                XpmFreeAttributes(&attributes);
+            }
+            _sample_add(&samples, _now() - start);
+            if (image) {
+                XDestroyImage(image);
+            }
+        }
+        snprintf(name, sizeof(name), "libxpm_read/%s", file);
+        _result_write(name, &samples);
+
+        /* Decoding, scaling and upload, then from the cache */
+        for (int warm = 0; warm <= 1; ++warm) {
+            for (int i = 0; i < _iterations; ++i) {
+                if (!warm) {
+                    _cache_clear(cache_dir);
+                }
+                icon_td *icon = _icon_new(display, window, files[f], 48);
+                unsigned long first = NextRequest(display);
+                double start = _now();
+                icon_load(icon);
+                XSync(display, False);
+                _sample_add(&samples, _now() - start);
+                samples.requests += NextRequest(display) - first;
+                icon_destroy(icon);
+            }
+            snprintf(name, sizeof(name), "icon_load/%s/%s",
+                    (warm) ? "warm" : "cold", file);
+            _result_write(name, &samples);
+        }
+
+        /* Same icon as one still shown: shared, nothing sent */
+        icon_td *shown = _icon_new(display, window, files[f], 48);
+        if (shown && icon_load(shown) != None) {
+            for (int i = 0; i < _iterations; ++i) {
+                icon_td *icon = _icon_new(display, window, files[f], 48);
+                unsigned long first = NextRequest(display);
+                double start = _now();
+                icon_load(icon);
+                XSync(display, False);
+                _sample_add(&samples, _now() - start);
+                samples.requests += NextRequest(display) - first;
+                icon_destroy(icon);
+            }
+            snprintf(name, sizeof(name), "icon_load/shared/%s", file);
+            _result_write(name, &samples);
+        }
+        icon_destroy(shown);
+    }
+
+    /* Server pixmap scaling, from the largest icon to every size */
+    icon_td *source = _icon_new(display, window,
+            (count > 0) ? files[count - 1] : "", 64);
+    if (source && count > 0 && icon_load(source) != None) {
+        for (int filter = SCALE_NEAREST; filter <= SCALE_BOX; ++filter) {
+            for (size_t s = 0; s < sizeof(sizes) / sizeof(*sizes); ++s) {
+                for (int i = 0; i < _iterations; ++i) {
+                    unsigned long first = NextRequest(display);
+                    double start = _now();
+                    Pixmap pixmap = pixmap_scale(display, source->pixmap,
+                            source->src_width, source->src_height,
+                            sizes[s], sizes[s], (scale_filter_td) filter);
+                    XSync(display, False);
+                    _sample_add(&samples, _now() - start);
+                    samples.requests += NextRequest(display) - first;
+                    if (pixmap != None) {
+                        XFreePixmap(display, pixmap);
+                    }
+                }
+                snprintf(name, sizeof(name), "pixmap_scale/%s/%ux%u-%u",
+                        filters[filter], source->src_width,
+                        source->src_height, sizes[s]);
+                _result_write(name, &samples);
+            }
+        }
+    }
+    icon_destroy(source);
+    const char *path = (count > 0) ? files[0] : "";
+
+    /* Whole icon: creation, load, window and first paint */
+    for (int i = 0; i < _iterations; ++i) {
+        unsigned long first = NextRequest(display);
+        double start = _now();
+        icon_td *icon = _icon_new(display, window, path, 48);
+        if (icon) {
+            icon_load(icon);
+            icon_create(icon);
+        }
+        XSync(display, False);
+        _sample_add(&samples, _now() - start);
+        samples.requests += NextRequest(display) - first;
+        icon_destroy(icon);
+        XMapWindow(display, window);
+    }
+    _result_write("icon_create/48", &samples);
+
+    /* Expose storm: a series of 64 small exposures, redrawn at once */
+    icon_td *icon = _icon_new(display, window, path, 48);
+    if (icon) {
+        icon_load(icon);
+        icon_create(icon);
+        XSync(display, False);
+        for (int i = 0; i < _iterations; ++i) {
+            XEvent event;
+            memset(&event, 0, sizeof(event));
+            event.xexpose.type = Expose;
+            event.xexpose.window = icon->window;
+            unsigned long first = NextRequest(display);
+            double start = _now();
+            for (int n = 63; n >= 0; --n) {
+                event.xexpose.x = (n % 8) * 6;
+                event.xexpose.y = (n / 8) * 8;
+                event.xexpose.width = 6;
+                event.xexpose.height = 8;
+                event.xexpose.count = n;
+                icon_event(icon, &event);
+            }
+            XSync(display, False);
+            _sample_add(&samples, _now() - start);
+            samples.requests += NextRequest(display) - first;
+        }
+        _result_write("expose_storm/64", &samples);
+
+        /* Restore: until the original window is mapped again */
+        for (int i = 0; i < _iterations; ++i) {
+            XEvent event;
+            XUnmapWindow(display, window);
+            XMapWindow(display, icon->window);
+            XSync(display, False);
+            while (XPending(display)) {
+                XNextEvent(display, &event);
+            }
+            unsigned long first = NextRequest(display);
+            double start = _now();
+            window_restore(icon);
+            do {
+                XNextEvent(display, &event);
+            } while (event.type != MapNotify ||
+                    event.xmap.window != window);
+            _sample_add(&samples, _now() - start);
+            samples.requests += NextRequest(display) - first;
+        }
+        _result_write("window_restore", &samples);
+        icon_destroy(icon);
+    }
+
+    XDestroyWindow(display, window);
+    XSync(display, False);
+
+    _bench_window_info(display);
+    _bench_round_trips(display, path);
+    _bench_soak(display, path);
+}
+
+
+/* Show help */
+static void _help_show(FILE *fp, const char basename[])
+{
+    fprintf(fp, "Usage: %s [<options>]\n", basename);
+    fprintf(fp, "Options:\n");
+    fprintf(fp, "   -h          This help\n");
+    fprintf(fp, "   -d <dir>    Directory of the icon files to load\n");
+    fprintf(fp, "   -n <count>  Iterations of every benchmark\n");
+    fprintf(fp, "   -x          Use $DISPLAY instead of a private Xvfb\n");
+    fprintf(fp, "   -m          Only the benchmarks without a display\n");
+    fprintf(fp, "   -G          Write the reference images again\n");
+    fprintf(fp, "\n");
+}
+
+
+/* Main entry */
+int main(int argc, char *argv[])
+{
+    static char files[BENCH_MAX_FILES][BENCH_MAX_PATH];
+    const char *dir = "tmp/images";
+    char display_name[32];
+    char cache[] = "/tmp/iconify-bench-XXXXXX";
+    Bool use_display = False;
+    Bool memory_only = False;
+    pid_t xvfb = -1;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "hd:n:xmG")) != -1) {
+        switch (opt) {
+            case 'h':
+                _help_show(stdout, argv[0]);
+                exit(EXIT_SUCCESS);
+                break;
+            case 'd':
+                dir = optarg;
+                break;
+            case 'n':
+                _iterations = (atoi(optarg) > 0) ? atoi(optarg) : 1;
+                break;
+            case 'x':
+                use_display = True;
+                break;
+            case 'm':
+                memory_only = True;
+                break;
+            case 'G':
+                _golden_update = True;
+                break;
+            default:
+                _help_show(stderr, argv[0]);
+                exit(EXIT_FAILURE);
+        }
+    }
+
+    size_t count = _files_find(dir, files, 0);
+
+    /* Icons are cached in a directory of their own, so that runs are
+     * not affected by the user cache, nor affect it */
+    if (!mkdtemp(cache)) {
+        fprintf(stderr, "Error: could not create the cache directory\n");
+        exit(EXIT_FAILURE);
+    }
+    setenv("XDG_CACHE_HOME", cache, 1);
+
+    Display *display = NULL;
+    if (!memory_only && !use_display) {
+        xvfb = _xvfb_start(display_name, sizeof(display_name));
+        if (xvfb > 0) {
+            display = XOpenDisplay(display_name);
+        } else {
+            fprintf(stderr, "Xvfb is not available: only the benchmarks "
+                    "without a display are run\n");
+        }
+    } else if (!memory_only) {
+        display = XOpenDisplay(NULL);
+    }
+
+    printf("{\n  \"backend\": \"%s\",\n  \"display\": \"%s\",\n"
+            "  \"iterations\": %d,\n  \"results\": [",
+            backend_name(),
+            (display) ? ((xvfb > 0) ? "xvfb" : "existing") : "none",
+            _iterations);
+    _bench_memory(dir, files, count);
+    _bench_drag();
+    if (display) {
+        _bench_display(display, dir, files, count, cache);
+        XCloseDisplay(display);
+    }
+    printf("\n  ]\n}\n");
+
+    if (xvfb > 0) {
+        kill(xvfb, SIGTERM);
+        waitpid(xvfb, NULL, 0);
+    }
+    char cache_dir[BENCH_MAX_PATH];
+    snprintf(cache_dir, sizeof(cache_dir), "%s/iconify", cache);
+    _cache_clear(cache_dir);
+    rmdir(cache_dir);
+    rmdir(cache);
+
+    return (_failed) ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,94 @@
+/**
+ * @file atoms.h
+ *
+ * @brief Atoms used by iconify, interned at once
+ */
+/*
+ * ISC License
+ * Copyright (c) 2025, J. A. Corbal <jacorbal@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS.  IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS
+ * ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF
+ * THIS SOFTWARE.
+ */
+
+#ifndef ATOMS_H
+#define ATOMS_H
+
+/* X includes */
+#include <X11/Xlib.h>   /* Atom, Display */
+
+
+/**
+ * @typedef atom_td
+ *
+ * @brief Index of every atom in the table returned by @c atoms_get
+ */
+typedef enum {
+    ATOM_WM_DELETE_WINDOW,
+    ATOM_WM_CHANGE_STATE,
+    ATOM_NET_WM_WINDOW_TYPE,
+    ATOM_NET_WM_WINDOW_TYPE_DESKTOP,
+    ATOM_NET_WM_STATE,
+    ATOM_NET_WM_STATE_BELOW,
+    ATOM_NET_WM_STATE_SKIP_TASKBAR,
+    ATOM_NET_WM_STATE_SKIP_PAGER,
+    ATOM_NET_WM_ICON,
+    ATOM_NET_CLIENT_LIST,
+    ATOM_ICONIFY_SNAPSHOT,          /**< Thumbnail ready (client message) */
+    ATOM_COUNT                      /**< Number of atoms, not an atom */
+} atom_td;
+
+
+/* Prototypes */
+/**
+ * @brief Get the table of atoms of a display
+ *
+ * @param display Display the atoms belong to
+ *
+ * @return Table of atoms, indexed by @c atom_td
+ *
+ * @note Every atom is interned in a single round trip the first time
+ *       this is called for the display; then, no request is made
+ */
+const Atom *atoms_get(Display *display);
+
+/**
+ * @brief Whether the atoms of a display are already interned
+ *
+ * @param display Display the atoms belong to
+ *
+ * @return @c True if @c atoms_get will not make any request
+ */
+Bool atoms_ready(Display *display);
+
+/**
+ * @brief Get the name of an atom
+ *
+ * @param atom Atom index
+ *
+ * @return Atom name
+ */
+const char *atoms_name(atom_td atom);
+
+/**
+ * @brief Set the table of atoms of a display, interned elsewhere
+ *
+ * @param display Display the atoms belong to
+ * @param atoms   Table of atoms, indexed by @c atom_td
+ *
+ * @note Used by backends that intern the atoms along other requests
+ */
+void atoms_set(Display *display, const Atom *atoms);
+
+
+#endif /* ! ATOMS_H */
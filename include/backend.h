@@ -0,0 +1,108 @@
+/**
+ * @file backend.h
+ *
+ * @brief Queries to the X server, as implemented by the chosen backend
+ *
+ * The Xlib backend asks the server one question at a time, waiting for
+ * every answer.  The XCB backend sends every question first and then
+ * collects the answers, so the whole query costs a single latency.
+ * The backend is chosen at build time (see the Makefile).
+ */
+/*
+ * ISC License
+ * Copyright (c) 2025, J. A. Corbal <jacorbal@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS.  IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS
+ * ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF
+ * THIS SOFTWARE.
+ */
+
+#ifndef BACKEND_H
+#define BACKEND_H
+
+/* Standard library includes */
+#include <stddef.h>     /* size_t */
+#include <stdint.h>     /* uint32_t */
+
+/* X includes */
+#include <X11/Xlib.h>   /* Bool, Display, Window */
+
+
+/**
+ * @typedef window_info_td
+ *
+ * @brief What iconify needs to know about a window before iconifying it
+ */
+typedef struct {
+    Bool exists;            /**< Window exists */
+    int x;                  /**< Absolute X coordinate (px) */
+    int y;                  /**< Absolute Y coordinate (px) */
+    char *res_name;         /**< Resource name, if any (allocated) */
+    char *res_class;        /**< Resource class, if any (allocated) */
+    Bool icon_read;         /**< '_NET_WM_ICON' was asked for */
+    uint32_t *icon;         /**< Its values, if any (allocated); see
+                                 @c netwm_icon_choose */
+    size_t icon_length;     /**< Number of values */
+} window_info_td;
+
+
+/* Prototypes */
+/**
+ * @brief Name of the backend, as chosen at build time
+ *
+ * @return "xlib" or "xcb"
+ */
+const char *backend_name(void);
+
+/**
+ * @brief Query everything iconify needs to know about a window
+ *
+ * @param display Display where the window is
+ * @param window  Window to query
+ * @param icon    Whether to read its '_NET_WM_ICON' too
+ * @param info    Where to store the information
+ *
+ * @note The atoms of the display are also interned, if they were not
+ *       already, together with the rest of the query
+ * @note Strings in @p info must be released with @c window_info_free
+ */
+void window_info_get(Display *display, Window window, Bool icon,
+        window_info_td *info);
+
+/**
+ * @brief Query everything iconify needs to know about several windows
+ *
+ * @param display Display where the windows are
+ * @param windows Windows to query
+ * @param count   Number of windows
+ * @param icons   Whether to read the '_NET_WM_ICON' of each window,
+ *                which may be large; or @c NULL for none
+ * @param infos   Where to store the information, one per window
+ *
+ * @note With the XCB backend, the questions about every window are sent
+ *       before any answer is read, so the whole batch costs a single
+ *       latency (two, the first time, if icons are read: their atom is
+ *       needed first); with Xlib, two or three round trips per window
+ * @note Strings in @p infos must be released with @c window_info_free
+ */
+void window_info_get_all(Display *display, const Window *windows,
+        unsigned int count, const Bool *icons, window_info_td *infos);
+
+/**
+ * @brief Release the strings and the icon of a window information
+ *
+ * @param info Window information to release
+ */
+void window_info_free(window_info_td *info);
+
+
+#endif /* ! BACKEND_H */
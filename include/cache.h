@@ -0,0 +1,114 @@
+/**
+ * @file cache.h
+ *
+ * @brief Persistent cache of decoded and scaled icons
+ *
+ * Every icon file read is stored already decoded and scaled, in the
+ * pixel format of the display, in a file that can be mapped in memory
+ * and sent to the server without any parsing.  Entries are keyed by
+ * source path, target size, filter and pixel format, and are stale as
+ * soon as the source file changes (modification time or size).
+ */
+/*
+ * ISC License
+ * Copyright (c) 2025, J. A. Corbal <jacorbal@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS.  IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS
+ * ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF
+ * THIS SOFTWARE.
+ */
+
+#ifndef CACHE_H
+#define CACHE_H
+
+/* Standard library includes */
+#include <stddef.h>     /* size_t */
+#include <stdint.h>     /* uint64_t */
+
+/* X includes */
+#include <X11/Xlib.h>   /* Bool, Display, Pixmap, XImage */
+
+/* Local includes */
+#include <pixbuf.h>     /* pixbuf_td */
+
+
+/* Prototypes */
+/**
+ * @brief Get the directory of the cache
+ *
+ * @param buffer Where to store the directory path
+ * @param size   Size of @p buffer
+ * @param create Whether to create the directory, if missing
+ *
+ * @return 0 on success, or -1 if there is no home directory, the path
+ *         is too long, or it cannot be created
+ */
+int cache_directory(char *buffer, size_t size, Bool create);
+
+/**
+ * @brief Create a pixmap from the cached icon of a file
+ *
+ * @param display Display where to create the pixmap
+ * @param path    Source file path
+ * @param stamp   Stamp of the source file and of its variants (see
+ *                @c pyramid_stamp)
+ * @param width   Icon width (px)
+ * @param height  Icon height (px)
+ * @param filter  Filter used to scale the icon
+ *
+ * @return New pixmap of @p width x @p height, or @c None if the icon is
+ *         not cached, or if the source file or any of its variants has
+ *         changed since
+ */
+Pixmap cache_pixmap_load(Display *display, const char *path,
+        uint64_t stamp, unsigned int width, unsigned int height,
+        int filter);
+
+/**
+ * @brief Store the decoded and scaled icon of a file
+ *
+ * @param display Display the image belongs to
+ * @param path    Source file path
+ * @param stamp   Stamp of the source file and of its variants, as they
+ *                were decoded
+ * @param image   Icon, already scaled
+ * @param filter  Filter used to scale the icon
+ *
+ * @note Failures are ignored: the icon will just be decoded again
+ */
+void cache_image_store(Display *display, const char *path,
+        uint64_t stamp, const XImage *image, int filter);
+
+/**
+ * @brief Get the icon published by a window, as stored by a previous
+ *        run
+ *
+ * @param key Key of its pixels and size
+ *
+ * @return New pixel buffer, or @c NULL if it is not cached
+ */
+pixbuf_td *cache_pixbuf_load(uint64_t key);
+
+/**
+ * @brief Store the icon published by a window, so that it can be loaded
+ *        again without asking the window for it
+ *
+ * @param key    Key of its pixels and size
+ * @param pixbuf Icon, as published
+ *
+ * @note Nothing is written if it is already stored, as the same key is
+ *       the same content; failures are ignored
+ */
+void cache_pixbuf_store(uint64_t key, const pixbuf_td *pixbuf);
+
+
+#endif /* ! CACHE_H */
@@ -0,0 +1,117 @@
+/**
+ * @file compose.h
+ *
+ * @brief Icon composition in client memory
+ *
+ * The layout of the icon window (border, icon area, caption and text)
+ * is computed here for both renderers: the X one draws it with requests
+ * on the backing pixmap, and the one here draws it in a pixel buffer,
+ * with no X server at all, for golden images and benchmarks.
+ */
+/*
+ * ISC License
+ * Copyright (c) 2025, J. A. Corbal <jacorbal@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS.  IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS
+ * ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF
+ * THIS SOFTWARE.
+ */
+
+#ifndef COMPOSE_H
+#define COMPOSE_H
+
+/* Local includes */
+#include <iconify.h>    /* icon_td */
+#include <pixbuf.h>     /* pixbuf_td */
+
+
+/**
+ * @typedef compose_layout_td
+ *
+ * @brief Places of every part of the icon window (px)
+ */
+typedef struct {
+    unsigned int width;         /**< Whole window width */
+    unsigned int height;        /**< Whole window height */
+    int inner_x;                /**< Area inside the border, left */
+    int inner_y;                /**< Area inside the border, top */
+    unsigned int inner_width;   /**< Area inside the border, width */
+    unsigned int inner_height;  /**< Area inside the border, height */
+    int icon_x;                 /**< Icon area left */
+    int icon_y;                 /**< Icon area top */
+    unsigned int icon_width;    /**< Icon area width */
+    unsigned int icon_height;   /**< Icon area height */
+    int caption_x;              /**< Caption left */
+    int caption_y;              /**< Caption top */
+    unsigned int caption_width;     /**< Caption width, or 0 if none */
+    unsigned int caption_height;    /**< Caption height, or 0 if none */
+    int text_x;                 /**< Text origin, left */
+    int text_y;                 /**< Text origin, baseline */
+} compose_layout_td;
+
+
+/* Prototypes */
+/**
+ * @brief Compute the layout of the icon window
+ *
+ * @param icon   Icon to lay out
+ * @param layout Where to store the layout
+ */
+void compose_layout(const icon_td *icon, compose_layout_td *layout);
+
+/**
+ * @brief Lay out a caption: the name, cut and ended with an ellipsis
+ *        ("...") if it does not fit
+ *
+ * @param name  Name to show
+ * @param width Caption width (px), margins included
+ *
+ * @return New string to draw at the text origin, to be released with
+ *         @c free, or @c NULL if out of memory
+ *
+ * @note Measured with the built-in font (see 'font.h'), of the same
+ *       width as the one of the X server, so both renderers cut it the
+ *       same way
+ */
+char *compose_caption(const char *name, unsigned int width);
+
+/**
+ * @brief Compose the icon window in a pixel buffer
+ *
+ * @param icon  Icon to compose; its size, border, colors, caption and
+ *              filter are used, but not its display nor its windows
+ * @param image Icon image, of any size, or @c NULL to leave the icon
+ *              area blank
+ *
+ * @return New opaque pixel buffer of the whole window, or @c NULL if out
+ *         of memory
+ *
+ * @note Colors are taken as 0xRRGGBB, and the caption is drawn with the
+ *       built-in font (see 'font.h'), as laid out by
+ *       @c compose_caption, so the result depends on nothing but the
+ *       arguments
+ */
+pixbuf_td *compose_icon(const icon_td *icon, const pixbuf_td *image);
+
+/**
+ * @brief Write a pixel buffer to a file
+ *
+ * @param pixbuf Pixel buffer to write
+ * @param path   File path; PAM (RGB and alpha) if it ends in ".pam",
+ *               or else binary PPM (RGB)
+ *
+ * @return 0 on success, or -1 if the file could not be written
+ */
+int compose_write(const pixbuf_td *pixbuf, const char *path);
+
+
+#endif /* ! COMPOSE_H */
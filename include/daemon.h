@@ -0,0 +1,124 @@
+/**
+ * @file daemon.h
+ *
+ * @brief Iconify daemon declaration
+ *
+ * A single process keeps every icon on one X connection, and new
+ * windows are iconified by sending a request through a UNIX socket.
+ * A request may iconify or restore a whole batch of windows, chosen by
+ * ID, by class or by group: every X request of the batch is sent
+ * together, with a single flush.
+ */
+/*
+ * ISC License
+ * Copyright (c) 2025, J. A. Corbal <jacorbal@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS.  IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS
+ * ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF
+ * THIS SOFTWARE.
+ */
+
+#ifndef DAEMON_H
+#define DAEMON_H
+
+/* Standard library includes */
+#include <stddef.h>     /* size_t */
+
+/* X includes */
+#include <X11/Xlib.h>   /* Display */
+
+/* Local includes */
+#include <defaults.h>   /* MAX_APP_NAME_LENGTH, MAX_PATH_LENGTH */
+
+
+/* Most windows given by ID in a single request */
+#define REQUEST_WINDOWS_MAX (64)
+
+/**
+ * @typedef request_type_td
+ *
+ * @brief Operations a client can request to the daemon
+ */
+typedef enum {
+    REQUEST_ICONIFY,    /**< Iconify the windows given, or of a class */
+    REQUEST_REPACK,     /**< Place every icon again, near its anchor */
+    REQUEST_RESTORE,    /**< Restore the windows of the icons chosen */
+} request_type_td;
+
+
+/**
+ * @typedef request_td
+ *
+ * @brief Request sent by a client to the daemon
+ *
+ * @note Both ends are the same binary, so the request is sent as is
+ */
+typedef struct {
+    int type;                       /**< Request type */
+    unsigned int count;             /**< Number of windows given */
+    unsigned long windows[REQUEST_WINDOWS_MAX]; /**< Windows, by ID */
+    char res_class[MAX_APP_NAME_LENGTH];    /**< Windows of this class
+                                                 or name, if not empty */
+    char group[MAX_APP_NAME_LENGTH];    /**< Group to add the icons to,
+                                             or to restore, if not empty */
+    char name[MAX_APP_NAME_LENGTH]; /**< Icon name, or empty for class */
+    char path[MAX_PATH_LENGTH];     /**< Icon path */
+    unsigned int border;            /**< Icon border (px) */
+    unsigned int width;             /**< Icon width (px) */
+    unsigned int height;            /**< Icon height (px) */
+    unsigned long bg;               /**< Text background color */
+    unsigned long fg;               /**< Text foreground color */
+    unsigned long fc;               /**< Frame color */
+    int show_text;                  /**< Display text under icon */
+    int filter;                     /**< Scaling filter */
+    int snapshot;                   /**< Show a snapshot of the window */
+    unsigned int live_rate;         /**< Snapshot refreshes per second */
+    int anchor;                     /**< Place the icon near the anchor */
+    int x_anchor;                   /**< Anchor, left */
+    int y_anchor;                   /**< Anchor, top */
+} request_td;
+
+
+/* Prototypes */
+/**
+ * @brief Get the path of the daemon socket for the current display
+ *
+ * @param buffer Where to store the path
+ * @param size   Size of the buffer
+ *
+ * @return @c buffer, or @c NULL if the path does not fit
+ */
+char *daemon_socket_path(char *buffer, size_t size);
+
+/**
+ * @brief Send a request to a running daemon
+ *
+ * @param socket_path Daemon socket path
+ * @param request     Request to send
+ *
+ * @return 0 if the daemon handled the request, 1 if it failed to
+ *         handle it, or -1 if there is no daemon to send it to
+ */
+int daemon_send(const char *socket_path, const request_td *request);
+
+/**
+ * @brief Run the daemon until it is interrupted
+ *
+ * @param display     Display where the icons are
+ * @param socket_path Socket where to listen to requests
+ *
+ * @return 0 on a clean exit, or -1 if the socket cannot be set up
+ */
+int daemon_run(Display *display, const char *socket_path);
+
+
+#endif /* ! DAEMON_H */
@@ -23,6 +23,9 @@
 
 // TODO: Use 'const' within a struct
 #define MAX_APP_NAME_LENGTH 100
+#define MAX_PATH_LENGTH 4096
+#define MAX_NETWM_ICON_LENGTH (1L << 18)    /* 1 MiB: up to 256x256 */
+#define MAX_CLIENTS_LENGTH (4096L)          /* windows listed by the WM */
 #define DEFAULT_TEXT_HEIGHT (20)    /* (px): text height */
 #define DEFAULT_TEXT_VOFFSET (15)   /* (px): space for vertical offset */
 #define DEFAULT_TEXT_LOFFSET (5)    /* (px): space from left sife */
@@ -32,5 +35,11 @@
 #define DEFAULT_TEXT_BG (0xFFFFFF)  /* background: white */
 #define DEFAULT_TEXT_FG (0x000000)  /* foreground: black */
 #define DEFAULT_TEXT_FC (0x000000)  /* frame color: black */
+#define DEFAULT_SCALE_FILTER (SCALE_BOX)    /* see 'scale.h' */
+#define DEFAULT_LIVE_RATE (4)       /* (Hz): live snapshot refreshes */
+#define DEFAULT_DRAG_RATE (60)      /* (Hz): icon moves while dragging */
+#define DEFAULT_ICON_GAP (4)        /* (px): between icons placed */
 
 #define DEFAULT_ICON_PATH "/usr/share/pixmaps/default.xpm"
+#define DEFAULT_SOCKET_NAME "iconify"    /* daemon: <name>-<display>.sock */
+#define DEFAULT_CACHE_NAME "iconify"     /* cache: ~/.cache/<name>/ */
@@ -0,0 +1,128 @@
+/**
+ * @file drag.h
+ *
+ * @brief Coalesced, frame-paced dragging
+ *
+ * Pointer motion only updates the target position of the drag; the
+ * window is moved to the latest target at most once per frame.  A
+ * pointer reporting at 1000 Hz costs as many moves as the display
+ * shows, and the first motion after an idle frame is moved at once.
+ *
+ * There are no X calls here: times are given by the caller, so that a
+ * recorded motion stream can be replayed as is.
+ */
+/*
+ * ISC License
+ * Copyright (c) 2025, J. A. Corbal <jacorbal@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS.  IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS
+ * ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF
+ * THIS SOFTWARE.
+ */
+
+#ifndef DRAG_H
+#define DRAG_H
+
+/* X includes */
+#include <X11/Xlib.h>   /* Bool */
+
+
+/**
+ * @typedef drag_td
+ *
+ * @brief State of a drag
+ */
+typedef struct {
+    Bool active;            /**< A drag is in progress */
+    int x_start;            /**< Pointer X at the start, in the window */
+    int y_start;            /**< Pointer Y at the start, in the window */
+    int x;                  /**< Target window X */
+    int y;                  /**< Target window Y */
+    Bool pending;           /**< The window is not at the target yet */
+    long long interval;     /**< Least time between moves (us) */
+    long long last;         /**< Time of the last move (us) */
+} drag_td;
+
+
+/* Prototypes */
+/**
+ * @brief Initialize the state of a drag
+ *
+ * @param drag Drag to initialize
+ * @param rate Most moves per second, usually the display refresh rate
+ */
+void drag_init(drag_td *drag, unsigned int rate);
+
+/**
+ * @brief Get the current monotonic time
+ *
+ * @return Time (us)
+ */
+long long drag_now(void);
+
+/**
+ * @brief Start a drag
+ *
+ * @param drag    Drag to start
+ * @param x_start Pointer X, relative to the window being dragged
+ * @param y_start Pointer Y, relative to the window being dragged
+ */
+void drag_start(drag_td *drag, int x_start, int y_start);
+
+/**
+ * @brief Take a pointer motion
+ *
+ * @param drag   Drag in progress
+ * @param x_root Pointer X, relative to the root window
+ * @param y_root Pointer Y, relative to the root window
+ *
+ * @return @c True if the motion moved the target
+ */
+Bool drag_motion(drag_td *drag, int x_root, int y_root);
+
+/**
+ * @brief Time until the window has to be moved
+ *
+ * @param drag Drag in progress
+ * @param now  Current time (us)
+ *
+ * @return Time (ms), 0 if due now, or -1 if the window is at the target
+ */
+int drag_timeout(const drag_td *drag, long long now);
+
+/**
+ * @brief Whether the window has to be moved now
+ *
+ * @param drag Drag in progress
+ * @param now  Current time (us)
+ * @param x    Where to store the window X, if it has to be moved
+ * @param y    Where to store the window Y, if it has to be moved
+ *
+ * @return @c True if the window has to be moved to (@p x, @p y), and
+ *         then it is taken as moved at @p now
+ */
+Bool drag_step(drag_td *drag, long long now, int *x, int *y);
+
+/**
+ * @brief Stop a drag
+ *
+ * @param drag Drag to stop
+ * @param x    Where to store the final window X, if it has to be moved
+ * @param y    Where to store the final window Y, if it has to be moved
+ *
+ * @return @c True if the window has to be moved to (@p x, @p y), as the
+ *         last target was not reached yet
+ */
+Bool drag_stop(drag_td *drag, int *x, int *y);
+
+
+#endif /* ! DRAG_H */
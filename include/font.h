@@ -0,0 +1,48 @@
+/**
+ * @file font.h
+ *
+ * @brief Built-in bitmap font, for rendering without an X server
+ *
+ * Printable ASCII in 6x13 cells, the size of the "fixed" font of the X
+ * server, so that the caption takes the same room in both renderers.
+ */
+/*
+ * ISC License
+ * Copyright (c) 2025, J. A. Corbal <jacorbal@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS.  IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS
+ * ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF
+ * THIS SOFTWARE.
+ */
+
+#ifndef FONT_H
+#define FONT_H
+
+
+#define FONT_WIDTH (6)      /* (px): advance of every glyph */
+#define FONT_HEIGHT (13)    /* (px): rows of every glyph */
+#define FONT_ASCENT (10)    /* (px): rows above the baseline */
+#define FONT_FIRST (32)     /* First character: ' ' */
+#define FONT_LAST (126)     /* Last character: '~' */
+
+
+/**
+ * @brief Glyphs from @c FONT_FIRST to @c FONT_LAST
+ *
+ * @note Every pixel is a byte with its coverage, from 0 (none) to 255
+ *       (full), as an 8 bits alpha mask
+ */
+extern const unsigned char font_glyphs[FONT_LAST - FONT_FIRST + 1]
+    [FONT_HEIGHT][FONT_WIDTH];
+
+
+#endif /* ! FONT_H */
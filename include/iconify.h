@@ -30,9 +30,35 @@
 #ifndef ICONIFIY_H
 #define ICONIFIY_H
 
+/* Standard library includes */
+#include <stdint.h>     /* uint64_t */
+
 /* X includes */
 #include <X11/Xlib.h>   /* Bool, Display, Pixmap, Window */
 
+/* Local includes */
+#include <backend.h>    /* window_info_td */
+#include <drag.h>       /* drag_td */
+#include <live.h>       /* live_td */
+#include <pixbuf.h>     /* pixbuf_td */
+#include <place.h>      /* place_item_td */
+#include <scale.h>      /* scale_filter_td */
+#include <snapshot.h>   /* snapshot_td */
+
+
+/**
+ * @typedef icon_source_td
+ *
+ * @brief Where the pixmap of an icon came from, to load it again from
+ *        there without looking for it (see 'state.h')
+ */
+typedef enum {
+    ICON_SOURCE_NONE,       /**< Not loaded yet: every source is tried */
+    ICON_SOURCE_FILE,       /**< File given, or found in the themes */
+    ICON_SOURCE_NETWM,      /**< Icon published by the window */
+    ICON_SOURCE_DEFAULT     /**< Default icon, as none other was found */
+} icon_source_td;
+
 
 /**
  * @typedef icon_td
@@ -42,19 +68,60 @@
 typedef struct {
     Display *display;       /**< X Display */
     Window window_orig;     /**< Icon associated window */
+    Bool orig_destroyed;    /**< Associated window no longer exists */
     Window window;          /**< Icon window */
     Pixmap pixmap;          /**< Icon pixmap */
+    uint64_t pixmap_key;    /**< Key of the shared icon pixmap, if any */
+    unsigned int src_width;     /**< Icon pixmap width (px) */
+    unsigned int src_height;    /**< Icon pixmap height (px) */
+    Bool pixmap_alpha;      /**< Icon pixmap is ARGB, for XRender */
+    Pixmap backing;         /**< Composed icon: pixmap, border and text */
+    uint64_t backing_key;   /**< Key of the shared backing, if any */
+    unsigned int backing_width;     /**< Backing pixmap width (px) */
+    unsigned int backing_height;    /**< Backing pixmap height (px) */
+    GC gc;                  /**< Graphics context used for drawing */
+    Bool dirty;             /**< Backing pixmap must be composed again */
     char *prog_name;        /**< Name of the associated program */
-    char *path;             /**< Icon path */
+    char *caption;          /**< Name as drawn, cut to fit, or @c NULL
+                                 until laid out */
+    unsigned int caption_width; /**< Width it was laid out for (px) */
+    char *path;             /**< Icon path; once loaded, the file found
+                                 in the themes, if it came from them */
+    Bool netwm_read;        /**< '_NET_WM_ICON' was read along with
+                                 the window, to be loaded */
+    pixbuf_td *netwm_icon;  /**< Icon it published, if any, until then */
+    icon_source_td source;  /**< Where the pixmap came from */
+    uint64_t source_key;    /**< Key of the pixels published by the
+                                 window, if it came from them */
+    char *res_name;         /**< Original window resource name, if any */
+    char *res_class;        /**< Original window class, if any */
+    char *group;            /**< Group the icon was added to, if any */
     unsigned int border;    /**< Icon border (px) */
     unsigned int width;     /**< Icon width (px) */
     unsigned int height;    /**< Icon heght (px) */
     int x_pos;              /**< Icon X initial position */
     int y_pos;              /**< Icon Y initial position */
+    place_item_td place;    /**< Area taken among the other icons */
     unsigned long bg;       /**< Text background color */
     unsigned long fg;       /**< Text foreground color */
     unsigned long fc;       /**< Frame color */
     Bool show_text;         /**< Display text under icon */
+    drag_td drag;           /**< Drag of the icon, if in progress */
+    Time last_click;        /**< Time of last click, for double clicks */
+    int x0_exposed;         /**< Pending exposed region, left */
+    int y0_exposed;         /**< Pending exposed region, top */
+    int x1_exposed;         /**< Pending exposed region, right */
+    int y1_exposed;         /**< Pending exposed region, bottom */
+    scale_filter_td filter; /**< Filter used to scale the icon */
+    Bool snapshot;          /**< Show a thumbnail of the window instead */
+    snapshot_td *snapshot_job;  /**< Thumbnail being reduced, if any */
+    unsigned int live_rate; /**< Thumbnail refreshes per second, or 0 */
+    live_td *live;          /**< Thumbnail following its window, if any */
+    Bool hidden;            /**< Original window kept viewable, out of
+                                 sight, instead of iconified */
+    int orig_x;             /**< Original window X position, to put it
+                                 back once hidden */
+    int orig_y;             /**< Original window Y position, likewise */
 } icon_td;
 
 
@@ -64,7 +131,6 @@ typedef struct {
  *
  * @param display     Display where to initialize this icon
  * @param window_orig Associated window to the new icon
- * @param pixmap      Icon pixmap
  * @param prog_name   Name of the program running on the associated window
  * @param path        Path to the icon file (xpm)
  * @param border      Icon border (px)
@@ -74,9 +140,48 @@ typedef struct {
  * @param text_fg     Icon text foreground color
  * @param frame_col   Frame color
  * @param show_text   Show text if @c true, or otherwise
+ *
+ * @return New icon, or @c NULL if there is no memory or if the original
+ *         window does not exist
+ *
+ * @note The original window is queried here, once, with every request
+ *       sent at once if the backend allows it (see 'backend.h'); its
+ *       class is kept for @c icon_load, and the pixmap is @c None until
+ *       then
  */
 icon_td *icon_init(Display *display, Window window_orig,
-        Pixmap pixmap, char *prog_name, const char *path,
+        const char *prog_name, const char *path,
+        unsigned int border, unsigned int width, unsigned int height,
+        unsigned long text_bg, unsigned long text_fg,
+        unsigned long frame_col, Bool show_text);
+
+/**
+ * @brief Initialize a new icon, from its window already queried
+ *
+ * @param display     Display where to initialize this icon
+ * @param window_orig Associated window to the new icon
+ * @param info        What has been queried about the window, such as by
+ *                    @c window_info_get_all for a batch of windows; its
+ *                    strings are taken by the icon, or released, and
+ *                    so is its '_NET_WM_ICON', if read, once the size
+ *                    that fits the icon is picked from it
+ * @param prog_name   Name of the program running on the associated window
+ * @param path        Path to the icon file (xpm)
+ * @param border      Icon border (px)
+ * @param width       Icon width (px)
+ * @param height      Icon height (px)
+ * @param text_bg     Icon text background color
+ * @param text_fg     Icon text foreground color
+ * @param frame_col   Frame color
+ * @param show_text   Show text if @c true, or otherwise
+ *
+ * @return New icon, or @c NULL if there is no memory or if the original
+ *         window does not exist
+ *
+ * @note No request is made
+ */
+icon_td *icon_init_info(Display *display, Window window_orig,
+        window_info_td *info, const char *prog_name, const char *path,
         unsigned int border, unsigned int width, unsigned int height,
         unsigned long text_bg, unsigned long text_fg,
         unsigned long frame_col, Bool show_text);
@@ -85,6 +190,10 @@ icon_td *icon_init(Display *display, Window window_orig,
  * @brief Destroy icon structure and free resources
  *
  * @param icon Icon to destroy
+ *
+ * @note The original window is left alone, unless it still exists: its
+ *       events stop being selected, and if it was kept out of sight for
+ *       a live thumbnail, it is put back rather than left out of reach
  */
 void icon_destroy(icon_td *icon);
 
@@ -92,6 +201,21 @@ void icon_destroy(icon_td *icon);
  * @brief Create new icon window
  *
  * @param icon Icon structure with information to create new icon
+ *
+ * @note The original window is followed from here on: the icon is
+ *       closed as soon as it is destroyed, or mapped again by anyone
+ *       else, such as the window manager or a taskbar (see
+ *       @c icon_event)
+ * @note No round trip is made: everything to know about the original
+ *       window has been queried by @c icon_init
+ * @note If @c snapshot is set, the original window is captured before
+ *       it is iconified, and the icon shows its thumbnail as soon as it
+ *       has been reduced, on a worker thread (see 'snapshot.h')
+ * @note With a @c live_rate too, and if the server can follow it (see
+ *       @c live_available), the original window is not iconified, as
+ *       an unmapped window does not change: it is moved off-screen,
+ *       below the other windows and out of taskbars and pagers, and
+ *       stays viewable until restored
  */
 void icon_create(icon_td *icon);
 
@@ -99,19 +223,55 @@ void icon_create(icon_td *icon);
  * @brief Draw icon and its text on its window
  *
  * @param icon Icon to be drawed on its own window
+ *
+ * @note The icon is composed once on a backing pixmap, which is just
+ *       copied to the window until the icon is invalidated; icons of
+ *       the same pixmap, size, colors and name share it (see
+ *       'registry.h')
+ * @note The caption is laid out once for its name and width, cut with
+ *       an ellipsis if it does not fit (see @c compose_caption), and
+ *       drawn from glyphs kept on the server (see 'render.h')
  */
 void icon_draw(icon_td *icon);
 
 /**
- * @brief Load icon for given window
+ * @brief Draw a region of the icon on its window
+ *
+ * @param icon   Icon to be drawed on its own window
+ * @param x      Region left coordinate, relative to the icon window
+ * @param y      Region top coordinate, relative to the icon window
+ * @param width  Region width (px)
+ * @param height Region height (px)
+ */
+void icon_expose(icon_td *icon, int x, int y,
+        unsigned int width, unsigned int height);
+
+/**
+ * @brief Mark the composed icon as outdated
  *
- * @param display     Display where to load the icon
- * @param path        Icon full path
- * @param widnow_orig Original associated window
+ * @param icon Icon whose size, colors, name or pixmap have changed
+ *
+ * @note The icon will be composed again on the next draw
+ */
+void icon_invalidate(icon_td *icon);
+
+/**
+ * @brief Load icon pixmap for given icon
+ *
+ * @param icon Icon whose path, or whose window, gives the pixmap
  *
  * @return Loaded icon as pixmap, or default icon, or @c None otherwise
+ *
+ * @note The first icon found is used among: the path given by the
+ *       user, the '_NET_WM_ICON' of the window, the pixmap named as
+ *       the window class, and the default icon
+ * @note The pixmap is also stored in the icon, along with its size; it
+ *       is shared by the icons of the same content (see 'registry.h')
+ * @note If the source is already set, as kept by a previous run, the
+ *       icon is loaded from it alone, without any lookup nor request;
+ *       every source is tried only if it is gone
  */
-Pixmap icon_load(Display *display, const char *path, Window window_orig);
+Pixmap icon_load(icon_td *icon);
 
 /**
  * @brief Pixmap scaling
@@ -122,17 +282,60 @@ Pixmap icon_load(Display *display, const char *path, Window window_orig);
  * @param height_old  Original pixmap height (px)
  * @param width_new   New pixmap width (px)
  * @param height_new  New pixmap height (px)
+ * @param filter      Resampling filter
  *
- * @return Scaled pixmap
+ * @return Scaled pixmap, or @c None if it could not be scaled
+ *
+ * @note The pixmap is read once, scaled in client memory and sent back
+ *       once, so the cost is a single round trip whatever its size
  */
 Pixmap pixmap_scale(Display *display, Pixmap pixmap_orig,
         unsigned int width_old, unsigned int height_old,
-        unsigned int width_new, unsigned int height_new);
+        unsigned int width_new, unsigned int height_new,
+        scale_filter_td filter);
+
+/**
+ * @brief Handle a single event addressed to the icon window, or to the
+ *        original window
+ *
+ * @param icon  Icon the event is addressed to
+ * @param event Event to handle
+ *
+ * @return @c True if the icon has been closed, or @c False otherwise
+ *
+ * @note The icon is closed when restored, and also when the original
+ *       window is destroyed (@c DestroyNotify) or mapped again by
+ *       anyone else (@c MapNotify)
+ */
+Bool icon_event(icon_td *icon, XEvent *event);
+
+/**
+ * @brief Time until the icon has to be refreshed
+ *
+ * @param icon Icon to check
+ *
+ * @return Time (ms), 0 if due now, or -1 if there is nothing to refresh
+ */
+int icon_timeout(const icon_td *icon);
+
+/**
+ * @brief Move a dragged icon, and refresh the damaged parts of a live
+ *        thumbnail, if due
+ *
+ * @param icon Icon to refresh
+ *
+ * @note Dragging moves the icon at most once per frame (see 'drag.h');
+ *       with a @c live_rate, the thumbnail follows the changes of its
+ *       window, kept viewable out of sight (see 'live.h')
+ */
+void icon_refresh(icon_td *icon);
 
 /**
  * @brief Icon mouse event handler on iconized window
  *
  * @param icon Icon where to handle its events
+ *
+ * @note Blocks until the icon is closed
  */
 void events_handle(icon_td *icon);
 
@@ -142,6 +345,8 @@ void events_handle(icon_td *icon);
  * @param icon Icon to be closed
  *
  * @note The icon holds the information of the windown to be restored
+ * @note A window kept out of sight for a live thumbnail is put back
+ *       where it was, and in taskbars and pagers again
  */
 void window_restore(icon_td *icon);
 
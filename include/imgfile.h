@@ -0,0 +1,52 @@
+/**
+ * @file imgfile.h
+ *
+ * @brief Native reader of XPM and XBM image files
+ *
+ * Files are mapped in memory and parsed in place, straight into a pixel
+ * buffer, with no intermediate copies of their text.
+ */
+/*
+ * ISC License
+ * Copyright (c) 2025, J. A. Corbal <jacorbal@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS.  IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS
+ * ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF
+ * THIS SOFTWARE.
+ */
+
+#ifndef IMGFILE_H
+#define IMGFILE_H
+
+/* Local includes */
+#include <pixbuf.h>     /* pixbuf_td */
+
+
+/* Prototypes */
+/**
+ * @brief Read an XPM (version 3) or XBM image file
+ *
+ * @param path Path to the image file
+ *
+ * @return New pixel buffer, or @c NULL if the file cannot be read, is
+ *         not in a supported format, or uses a color this reader does
+ *         not know
+ *
+ * @note Transparent XPM pixels are white with zero alpha; XBM images
+ *       are black on white
+ * @note On @c NULL, the caller may fall back to a complete reader, such
+ *       as libXpm, which resolves color names through the X server
+ */
+pixbuf_td *imgfile_read(const char *path);
+
+
+#endif /* ! IMGFILE_H */
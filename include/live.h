@@ -0,0 +1,136 @@
+/**
+ * @file live.h
+ *
+ * @brief Thumbnails that follow the changes of their window
+ *
+ * The window is kept viewable, out of sight (see @c icon_create), as an
+ * unmapped window has no contents and reports no damage.  It is
+ * redirected off-screen through XComposite and watched through XDamage.
+ * Damaged areas mark the tiles of the thumbnail they cover, and only
+ * those tiles are captured and reduced again, no more often than a given
+ * rate.  An unchanged window costs nothing, and a changing one costs its
+ * changes only.
+ */
+/*
+ * ISC License
+ * Copyright (c) 2025, J. A. Corbal <jacorbal@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS.  IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS
+ * ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF
+ * THIS SOFTWARE.
+ */
+
+#ifndef LIVE_H
+#define LIVE_H
+
+/* Standard library includes */
+#include <time.h>       /* timespec */
+
+/* X includes */
+#include <X11/Xlib.h>                   /* Bool, Display, Window, X* */
+#include <X11/extensions/Xdamage.h>     /* Damage */
+
+
+/**
+ * @typedef live_td
+ *
+ * @brief Thumbnail kept up to date with its window
+ */
+typedef struct {
+    Display *display;           /**< Display where the window is */
+    Window window;              /**< Window followed */
+    Damage damage;              /**< Damage object of the window */
+    int event_base;             /**< First XDamage event */
+    unsigned int src_width;     /**< Window width (px) */
+    unsigned int src_height;    /**< Window height (px) */
+    XImage *thumbnail;          /**< Thumbnail, 32 bits per pixel */
+    unsigned char *tiles;       /**< Whether every tile is damaged */
+    unsigned int tiles_x;       /**< Number of tile columns */
+    unsigned int tiles_y;       /**< Number of tile rows */
+    unsigned int damaged;       /**< Number of damaged tiles */
+    long interval;              /**< Least time between refreshes (ms) */
+    struct timespec last;       /**< Time of the last refresh */
+} live_td;
+
+
+/* Prototypes */
+/**
+ * @brief Whether the server can follow the changes of a window
+ *
+ * @param display Display to ask
+ *
+ * @return @c True if both XComposite and XDamage are available
+ */
+Bool live_available(Display *display);
+
+/**
+ * @brief Start following the changes of a window
+ *
+ * @param display    Display where the window is
+ * @param window     Window to follow
+ * @param thumbnail  Current thumbnail; taken over if this succeeds
+ * @param src_width  Window width (px)
+ * @param src_height Window height (px)
+ * @param rate       Most refreshes per second
+ *
+ * @return New live thumbnail, or @c NULL if XComposite or XDamage is not
+ *         available, if the thumbnail is not 32 bits per pixel, or if
+ *         out of memory
+ */
+live_td *live_start(Display *display, Window window, XImage *thumbnail,
+        unsigned int src_width, unsigned int src_height,
+        unsigned int rate);
+
+/**
+ * @brief Stop following a window, and release the thumbnail
+ *
+ * @param live      Live thumbnail to release, or @c NULL
+ * @param destroyed Whether the window is destroyed, and its damage and
+ *                  redirection gone with it
+ */
+void live_stop(live_td *live, Bool destroyed);
+
+/**
+ * @brief Take the damage reported by an event
+ *
+ * @param live  Live thumbnail
+ * @param event Any event
+ *
+ * @return @c True if the event was a damage event for this window
+ */
+Bool live_event(live_td *live, const XEvent *event);
+
+/**
+ * @brief Time until the next refresh is due
+ *
+ * @param live Live thumbnail
+ *
+ * @return Time (ms), 0 if the refresh is due now, or -1 if there is
+ *         nothing to refresh
+ */
+int live_timeout(const live_td *live);
+
+/**
+ * @brief Capture and reduce the damaged tiles again, if due
+ *
+ * @param live    Live thumbnail
+ * @param changed Area of the thumbnail that changed
+ *
+ * @return @c True if the thumbnail changed
+ *
+ * @note Every run of consecutive damaged tiles costs a single
+ *       @c XGetImage of the window area those tiles cover
+ */
+Bool live_refresh(live_td *live, XRectangle *changed);
+
+
+#endif /* ! LIVE_H */
@@ -0,0 +1,111 @@
+/**
+ * @file monitors.h
+ *
+ * @brief Geometry of the monitors, as RandR reports it
+ *
+ * The monitors are queried once, and queried again only when RandR
+ * notifies that the screen has changed (@c RRScreenChangeNotify): icons
+ * are placed within the monitor of their window without asking the
+ * server every time.  Without RandR, the whole screen is taken as a
+ * single monitor.
+ */
+/*
+ * ISC License
+ * Copyright (c) 2025, J. A. Corbal <jacorbal@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS.  IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS
+ * ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF
+ * THIS SOFTWARE.
+ */
+
+#ifndef MONITORS_H
+#define MONITORS_H
+
+/* X includes */
+#include <X11/Xlib.h>   /* Bool, Display, XEvent, XRectangle */
+
+
+/* Most monitors kept; any other is ignored */
+#define MONITORS_MAX (16)
+
+
+/**
+ * @typedef monitors_td
+ *
+ * @brief Monitors of a screen, and whether they have to be queried again
+ */
+typedef struct {
+    XRectangle areas[MONITORS_MAX];     /**< Area of every monitor */
+    unsigned int count;     /**< Number of monitors, at least one */
+    unsigned int width;     /**< Screen width (px) */
+    unsigned int height;    /**< Screen height (px) */
+    int event_base;         /**< First RandR event, or -1 without RandR */
+    Bool monitor_list;      /**< RandR 1.5 lists the monitors itself */
+    Bool stale;             /**< The screen has changed since queried */
+} monitors_td;
+
+
+/* Prototypes */
+/**
+ * @brief Query the monitors, and ask to be notified of their changes
+ *
+ * @param monitors Monitors to fill in
+ * @param display  Display whose default screen is queried
+ */
+void monitors_init(monitors_td *monitors, Display *display);
+
+/**
+ * @brief Take a RandR notification, if the event is one
+ *
+ * @param monitors Monitors of the display
+ * @param event    Any event of the display
+ *
+ * @return @c True if the event was a screen change, which was taken
+ *
+ * @note The monitors are only queried again by @c monitors_update, so
+ *       that a burst of changes costs a single query
+ */
+Bool monitors_event(monitors_td *monitors, XEvent *event);
+
+/**
+ * @brief Query the monitors again, if the screen has changed
+ *
+ * @param monitors Monitors of the display
+ * @param display  Display whose default screen is queried
+ *
+ * @return @c True if the monitors were queried again
+ */
+Bool monitors_update(monitors_td *monitors, Display *display);
+
+/**
+ * @brief Get the monitor of a point
+ *
+ * @param monitors Monitors of the display
+ * @param x        Point left
+ * @param y        Point top
+ *
+ * @return Monitor the point is on, or the nearest one if on none
+ */
+const XRectangle *monitors_find(const monitors_td *monitors, int x, int y);
+
+/**
+ * @brief Whether an area is seen on any monitor
+ *
+ * @param monitors Monitors of the display
+ * @param area     Area to check
+ *
+ * @return @c True if some part of the area is on a monitor
+ */
+Bool monitors_visible(const monitors_td *monitors, const XRectangle *area);
+
+
+#endif /* ! MONITORS_H */
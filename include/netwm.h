@@ -0,0 +1,102 @@
+/**
+ * @file netwm.h
+ *
+ * @brief Icons published by the clients in '_NET_WM_ICON', and the
+ *        clients listed by the window manager in '_NET_CLIENT_LIST'
+ */
+/*
+ * ISC License
+ * Copyright (c) 2025, J. A. Corbal <jacorbal@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS.  IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS
+ * ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF
+ * THIS SOFTWARE.
+ */
+
+#ifndef NETWM_H
+#define NETWM_H
+
+/* Standard library includes */
+#include <stddef.h>     /* size_t */
+#include <stdint.h>     /* uint32_t */
+
+/* X includes */
+#include <X11/Xlib.h>   /* Display, Window */
+
+/* Local includes */
+#include <pixbuf.h>     /* pixbuf_td */
+
+
+/* Prototypes */
+/**
+ * @brief Get the icon of a window that best fits a size
+ *
+ * @param display Display where the window is
+ * @param window  Window whose icon to get
+ * @param width   Desired width (px)
+ * @param height  Desired height (px)
+ *
+ * @return Smallest icon not smaller than the size, or the largest one
+ *         if all of them are smaller; or @c NULL if the window has no
+ *         '_NET_WM_ICON' property
+ *
+ * @note The property is read in a single request, limited to
+ *       @c MAX_NETWM_ICON_LENGTH words; if it was already read along
+ *       with the rest of the window (see 'backend.h'), use
+ *       @c netwm_icon_choose instead
+ */
+pixbuf_td *netwm_icon_get(Display *display, Window window,
+        unsigned int width, unsigned int height);
+
+/**
+ * @brief Read the '_NET_WM_ICON' property of a window
+ *
+ * @param display Display where the window is
+ * @param window  Window whose property to read
+ * @param length  Where to store the number of values
+ *
+ * @return Values of the property, narrowed to 32 bits, to be released
+ *         with @c free; or @c NULL if the window has none
+ */
+uint32_t *netwm_icon_read(Display *display, Window window, size_t *length);
+
+/**
+ * @brief Pick the icon that best fits a size among the values of a
+ *        '_NET_WM_ICON' property
+ *
+ * @param values Values of the property: width, height, and the pixels
+ *               of each icon in turn; or @c NULL
+ * @param length Number of values
+ * @param width  Desired width (px)
+ * @param height Desired height (px)
+ *
+ * @return As @c netwm_icon_get, without any request
+ */
+pixbuf_td *netwm_icon_choose(const uint32_t *values, size_t length,
+        unsigned int width, unsigned int height);
+
+/**
+ * @brief Get the client windows managed by the window manager
+ *
+ * @param display Display where the windows are
+ * @param clients Where to store the windows, to be released with
+ *                @c free
+ *
+ * @return Number of windows, or 0 if none (@p clients is then @c NULL)
+ *
+ * @note A single request: the '_NET_CLIENT_LIST' of the root window, or
+ *       its children if the window manager does not publish it
+ */
+unsigned int netwm_clients_get(Display *display, Window **clients);
+
+
+#endif /* ! NETWM_H */
@@ -0,0 +1,127 @@
+/**
+ * @file pixbuf.h
+ *
+ * @brief Client-side ARGB pixel buffers declaration
+ */
+/*
+ * ISC License
+ * Copyright (c) 2025, J. A. Corbal <jacorbal@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS.  IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS
+ * ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF
+ * THIS SOFTWARE.
+ */
+
+#ifndef PIXBUF_H
+#define PIXBUF_H
+
+/* Standard library includes */
+#include <stdint.h>     /* uint32_t */
+
+/* X includes */
+#include <X11/Xlib.h>   /* Display, Pixmap, XImage */
+
+/* Local includes */
+#include <scale.h>      /* scale_filter_td */
+
+
+/**
+ * @typedef pixbuf_td
+ *
+ * @brief Image in client memory, as non-premultiplied 0xAARRGGBB pixels
+ *
+ * @note Rows are contiguous: there is no padding between them
+ */
+typedef struct {
+    uint32_t *data;         /**< Pixels, row after row */
+    unsigned int width;     /**< Width (px) */
+    unsigned int height;    /**< Height (px) */
+} pixbuf_td;
+
+
+/* Prototypes */
+/**
+ * @brief Allocate a new pixel buffer
+ *
+ * @param width  Width (px)
+ * @param height Height (px)
+ *
+ * @return New uninitialized pixel buffer, or @c NULL if out of memory
+ */
+pixbuf_td *pixbuf_new(unsigned int width, unsigned int height);
+
+/**
+ * @brief Release a pixel buffer
+ *
+ * @param pixbuf Pixel buffer to release
+ */
+void pixbuf_destroy(pixbuf_td *pixbuf);
+
+/**
+ * @brief Scale a pixel buffer into a new one
+ *
+ * @param pixbuf Pixel buffer to scale
+ * @param width  New width (px)
+ * @param height New height (px)
+ * @param filter Resampling filter
+ *
+ * @return New pixel buffer, or @c NULL if out of memory
+ */
+pixbuf_td *pixbuf_scale(const pixbuf_td *pixbuf,
+        unsigned int width, unsigned int height, scale_filter_td filter);
+
+/**
+ * @brief Convert a pixel buffer into a new image of the default visual
+ *
+ * @param display    Display the image is for
+ * @param pixbuf     Pixel buffer to convert
+ * @param background Color (0xRRGGBB) behind transparent pixels
+ *
+ * @return New image of the default depth, or @c NULL if out of memory
+ *
+ * @note Pixels are blended and converted in a single pass
+ */
+XImage *pixbuf_to_image(Display *display, const pixbuf_td *pixbuf,
+        unsigned long background);
+
+/**
+ * @brief Upload a pixel buffer into a new pixmap
+ *
+ * @param display    Display where to create the pixmap
+ * @param pixbuf     Pixel buffer to upload
+ * @param background Color (0xRRGGBB) behind transparent pixels
+ *
+ * @return New pixmap of the default depth, or @c None on failure
+ *
+ * @note The image from @c pixbuf_to_image is sent with a single
+ *       @c upload_image (see 'upload.h')
+ */
+Pixmap pixbuf_to_pixmap(Display *display, const pixbuf_td *pixbuf,
+        unsigned long background);
+
+/**
+ * @brief Upload a pixel buffer into a new 32 bits ARGB pixmap
+ *
+ * @param display Display where to create the pixmap
+ * @param pixbuf  Pixel buffer to upload
+ *
+ * @return New pixmap of depth 32, with premultiplied pixels, or @c None
+ *         on failure
+ *
+ * @note The pixmap keeps the transparency of the pixels; it is meant to
+ *       be blended with XRender (see 'render.h'), and the server must
+ *       support depth 32 pixmaps
+ */
+Pixmap pixbuf_to_pixmap_argb(Display *display, const pixbuf_td *pixbuf);
+
+
+#endif /* ! PIXBUF_H */
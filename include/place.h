@@ -0,0 +1,162 @@
+/**
+ * @file place.h
+ *
+ * @brief Placement of icons on free areas of the screen
+ *
+ * Icons are kept in a uniform grid of cells over the screen, every one
+ * of them listed in the cells it covers, so that whether an area is free
+ * is known from the few icons around it, however many there are.  A new
+ * icon goes to its anchor (the position asked for, or the origin of its
+ * window) if it is free, or else to the nearest free slot: slots of its
+ * size are laid out over the screen, and searched ring after ring around
+ * the anchor.  Icons are always kept within the screen.
+ */
+/*
+ * ISC License
+ * Copyright (c) 2025, J. A. Corbal <jacorbal@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS.  IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS
+ * ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF
+ * THIS SOFTWARE.
+ */
+
+#ifndef PLACE_H
+#define PLACE_H
+
+/* X includes */
+#include <X11/Xlib.h>   /* Bool, XRectangle */
+
+
+/* Side of the grid cells (px); about an icon, so that an area is in a
+ * few cells only */
+#define PLACE_CELL_SIZE (64)
+
+
+/**
+ * @typedef place_item_td
+ *
+ * @brief Area taken by an icon
+ */
+typedef struct {
+    int x;                  /**< Left */
+    int y;                  /**< Top */
+    unsigned int width;     /**< Width (px) */
+    unsigned int height;    /**< Height (px) */
+    int x_anchor;           /**< Preferred left, to re-pack */
+    int y_anchor;           /**< Preferred top, to re-pack */
+    Bool placed;            /**< Listed in the grid */
+} place_item_td;
+
+
+/**
+ * @typedef place_cell_td
+ *
+ * @brief Items covering a cell of the grid
+ */
+typedef struct {
+    place_item_td **items;  /**< Items, in no order */
+    unsigned int count;     /**< Number of items */
+    unsigned int capacity;  /**< Room for items */
+} place_cell_td;
+
+
+/**
+ * @typedef place_td
+ *
+ * @brief Grid of the areas taken on the screen
+ */
+typedef struct {
+    int x;                  /**< Screen left */
+    int y;                  /**< Screen top */
+    unsigned int width;     /**< Screen width (px) */
+    unsigned int height;    /**< Screen height (px) */
+    unsigned int gap;       /**< Least space between icons (px) */
+    unsigned int columns;   /**< Cells per row */
+    unsigned int rows;      /**< Rows of cells */
+    place_cell_td *cells;   /**< Cells, row after row */
+} place_td;
+
+
+/* Prototypes */
+/**
+ * @brief Initialize an empty grid over the screen
+ *
+ * @param place  Grid to initialize
+ * @param x      Screen left
+ * @param y      Screen top
+ * @param width  Screen width (px)
+ * @param height Screen height (px)
+ * @param gap    Least space between icons (px)
+ *
+ * @return 0 on success, or -1 if out of memory
+ */
+int place_init(place_td *place, int x, int y,
+        unsigned int width, unsigned int height, unsigned int gap);
+
+/**
+ * @brief Release a grid; its items are left as they are
+ *
+ * @param place Grid to release
+ */
+void place_release(place_td *place);
+
+/**
+ * @brief Find the nearest free slot to the anchor of an item
+ *
+ * @param place  Grid to search
+ * @param item   Item to place, with its size and anchor; its position is
+ *               set, but it is not added
+ * @param bounds Area to keep the item in, such as its monitor, or
+ *               @c NULL for the whole screen
+ *
+ * @return @c True if a free slot was found, or @c False if the area is
+ *         full, and the anchor is then taken, within the area
+ *
+ * @note The slots are searched ring after ring around the anchor, so the
+ *       cost depends on how many icons are near it, not on how many
+ *       there are
+ */
+Bool place_find(const place_td *place, place_item_td *item,
+        const XRectangle *bounds);
+
+/**
+ * @brief Add an item at its position
+ *
+ * @param place Grid to add the item to
+ * @param item  Item, which must stay at the same address while added
+ *
+ * @return 0 on success, or -1 if out of memory
+ */
+int place_add(place_td *place, place_item_td *item);
+
+/**
+ * @brief Remove an item, if added
+ *
+ * @param place Grid to remove the item from
+ * @param item  Item to remove
+ */
+void place_remove(place_td *place, place_item_td *item);
+
+/**
+ * @brief Move an item, which is anchored at its new position
+ *
+ * @param place Grid where the item is
+ * @param item  Item to move
+ * @param x     New left
+ * @param y     New top
+ *
+ * @return 0 on success, or -1 if out of memory
+ */
+int place_move(place_td *place, place_item_td *item, int x, int y);
+
+
+#endif /* ! PLACE_H */
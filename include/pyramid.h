@@ -0,0 +1,119 @@
+/**
+ * @file pyramid.h
+ *
+ * @brief Icons at several sizes, scaled from the closest larger one
+ *
+ * An icon file may come with variants at other sizes, next to it and
+ * named after it: 'X11.xpm', 'X11_16x16.xpm', 'X11_32x32.xpm'...  All of
+ * them are read, at their real sizes, and every icon is scaled from the
+ * smallest one that is not smaller than the icon.  Missing levels are
+ * made by halving the next larger one, as a mipmap, so that the last
+ * scaling step never reduces by more than a half: it is cheaper, and
+ * even the nearest and bilinear filters look smooth.
+ */
+/*
+ * ISC License
+ * Copyright (c) 2025, J. A. Corbal <jacorbal@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS.  IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS
+ * ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF
+ * THIS SOFTWARE.
+ */
+
+#ifndef PYRAMID_H
+#define PYRAMID_H
+
+/* Standard library includes */
+#include <stdint.h>     /* uint64_t */
+
+/* Local includes */
+#include <pixbuf.h>     /* pixbuf_td */
+#include <scale.h>      /* scale_filter_td */
+
+
+/* Most levels of a pyramid: files read and halvings made */
+#define PYRAMID_MAX_LEVELS (16)
+
+
+/**
+ * @typedef pyramid_td
+ *
+ * @brief Levels of an icon, from the largest to the smallest
+ */
+typedef struct {
+    pixbuf_td *levels[PYRAMID_MAX_LEVELS];  /**< Levels, largest first */
+    unsigned int count;                     /**< Number of levels */
+} pyramid_td;
+
+
+/* Prototypes */
+/**
+ * @brief Read an icon file, and its variants at other sizes
+ *
+ * @param path Path to the icon file, or to any of its variants
+ *
+ * @return New pyramid, or @c NULL if the file itself cannot be read (see
+ *         @c imgfile_read); variants that cannot be read are ignored
+ */
+pyramid_td *pyramid_load(const char *path);
+
+/**
+ * @brief Get the stamp of an icon file and of its variants, as they are
+ *        now, to tell whether an icon made from them is still valid
+ *
+ * @param path  Path to the icon file
+ * @param stamp Where to store the stamp
+ *
+ * @return 0 on success, or -1 if the file does not exist
+ *
+ * @note The stamp changes with the file, and with any variant added,
+ *       removed, or changed (its size or its time); the directory is
+ *       listed, but no file is read
+ */
+int pyramid_stamp(const char *path, uint64_t *stamp);
+
+/**
+ * @brief Get the level to scale an icon from
+ *
+ * @param pyramid Pyramid to pick from; halved levels are added to it
+ * @param width   Icon width (px)
+ * @param height  Icon height (px)
+ *
+ * @return Smallest level not smaller than the icon, and not larger than
+ *         twice its size if it can be halved, or the largest level if
+ *         every one is smaller; it belongs to the pyramid
+ */
+const pixbuf_td *pyramid_level(pyramid_td *pyramid,
+        unsigned int width, unsigned int height);
+
+/**
+ * @brief Scale an icon from its closest larger level
+ *
+ * @param pyramid Pyramid to scale from
+ * @param width   Icon width (px)
+ * @param height  Icon height (px)
+ * @param filter  Resampling filter of the last step
+ *
+ * @return New pixel buffer, or @c NULL if out of memory
+ */
+pixbuf_td *pyramid_scale(pyramid_td *pyramid,
+        unsigned int width, unsigned int height, scale_filter_td filter);
+
+/**
+ * @brief Release a pyramid and all its levels
+ *
+ * @param pyramid Pyramid to release, or @c NULL
+ */
+void pyramid_destroy(pyramid_td *pyramid);
+
+
+#endif /* ! PYRAMID_H */
@@ -0,0 +1,107 @@
+/**
+ * @file registry.h
+ *
+ * @brief Pixmaps shared by every icon of the same content
+ *
+ * Many windows of the same program have the same icon: every one of
+ * them would keep its own copy on the server, and compose its own
+ * backing pixmap from it.  Pixmaps are kept here instead, by a key
+ * hashed from whatever they are made of (source content, size, colors),
+ * and counted: an icon asks for the pixmap of its key before making it,
+ * and releases it rather than freeing it, so that it is only freed
+ * along with its last user.
+ */
+/*
+ * ISC License
+ * Copyright (c) 2025, J. A. Corbal <jacorbal@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS.  IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS
+ * ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF
+ * THIS SOFTWARE.
+ */
+
+#ifndef REGISTRY_H
+#define REGISTRY_H
+
+/* Standard library includes */
+#include <stddef.h>     /* size_t */
+#include <stdint.h>     /* uint64_t */
+
+/* X includes */
+#include <X11/Xlib.h>   /* Bool, Display, Pixmap */
+
+
+/* Key to start hashing from, and key of the pixmaps not shared */
+#define REGISTRY_SEED (0xCBF29CE484222325ull)
+#define REGISTRY_NONE (0)
+
+
+/* Prototypes */
+/**
+ * @brief Hash some data into a key
+ *
+ * @param key    Key so far, or @c REGISTRY_SEED to start
+ * @param data   Data the pixmap is made of
+ * @param length Size of @p data (bytes)
+ *
+ * @return New key, never @c REGISTRY_NONE
+ */
+uint64_t registry_key(uint64_t key, const void *data, size_t length);
+
+/**
+ * @brief Get a shared pixmap, and count one more user
+ *
+ * @param display Display where the pixmap is
+ * @param key     Key of the pixmap
+ * @param width   Where to store the pixmap width (px), or @c NULL
+ * @param height  Where to store the pixmap height (px), or @c NULL
+ * @param alpha   Where to store whether the pixmap is ARGB, or @c NULL
+ *
+ * @return The pixmap of @p key, or @c None if there is none yet
+ */
+Pixmap registry_get(Display *display, uint64_t key,
+        unsigned int *width, unsigned int *height, Bool *alpha);
+
+/**
+ * @brief Share a new pixmap, with a single user
+ *
+ * @param display Display where the pixmap is
+ * @param key     Key of the pixmap, or @c REGISTRY_NONE not to share it
+ * @param pixmap  Pixmap, which now belongs to the registry
+ * @param width   Pixmap width (px)
+ * @param height  Pixmap height (px)
+ * @param alpha   Whether the pixmap is ARGB
+ *
+ * @note If it cannot be shared, for lack of memory, the pixmap is kept
+ *       by its single user, and freed on release as any other
+ */
+void registry_add(Display *display, uint64_t key, Pixmap pixmap,
+        unsigned int width, unsigned int height, Bool alpha);
+
+/**
+ * @brief Release a pixmap, freed when it has no user left
+ *
+ * @param display Display where the pixmap is
+ * @param key     Key of the pixmap, or @c REGISTRY_NONE if not shared
+ * @param pixmap  Pixmap to release, or @c None
+ */
+void registry_release(Display *display, uint64_t key, Pixmap pixmap);
+
+/**
+ * @brief Count the pixmaps shared
+ *
+ * @return Number of pixmaps in the registry, whatever their users
+ */
+unsigned int registry_count(void);
+
+
+#endif /* ! REGISTRY_H */
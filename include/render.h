@@ -0,0 +1,117 @@
+/**
+ * @file render.h
+ *
+ * @brief Server-side scaling and blending through XRender
+ *
+ * The icon pixmap is wrapped in a picture with a scaling transform and
+ * a filter, and composited over the icon area with a single request:
+ * the server scales it and blends its transparent pixels, and nothing
+ * goes through the client.
+ *
+ * Captions are drawn from a glyph set of the built-in font (see
+ * 'font.h'), sent to the server once and shared by every icon: a
+ * caption is then a single request, whatever its length.
+ */
+/*
+ * ISC License
+ * Copyright (c) 2025, J. A. Corbal <jacorbal@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS.  IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS
+ * ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF
+ * THIS SOFTWARE.
+ */
+
+#ifndef RENDER_H
+#define RENDER_H
+
+/* Standard library includes */
+#include <stddef.h>     /* size_t */
+
+/* X includes */
+#include <X11/Xlib.h>   /* Bool, Display, Drawable, Pixmap */
+
+/* Local includes */
+#include <scale.h>      /* scale_filter_td */
+
+
+/* Prototypes */
+/**
+ * @brief Whether the display can scale and blend pictures
+ *
+ * @param display Display to check
+ *
+ * @return @c True if RENDER 0.10 or later is available, with 32 bits
+ *         ARGB pictures and a picture format for the default visual
+ *
+ * @note The answer is kept for the last display asked about
+ */
+Bool render_available(Display *display);
+
+/**
+ * @brief Scale a pixmap and blend it over a drawable of the default
+ *        visual
+ *
+ * @param display    Display where both are
+ * @param pixmap     Source pixmap
+ * @param alpha      Whether @p pixmap is premultiplied 32 bits ARGB,
+ *                   instead of the default depth
+ * @param src_width  Source width (px)
+ * @param src_height Source height (px)
+ * @param drawable   Destination drawable
+ * @param x          Destination left (px)
+ * @param y          Destination top (px)
+ * @param width      Destination width (px)
+ * @param height     Destination height (px)
+ * @param filter     Resampling filter
+ *
+ * @return @c True if the composite was sent, or @c False if RENDER is
+ *         not available, and then nothing is drawn
+ *
+ * @note @c SCALE_BOX reductions use a box convolution of the size of
+ *       the reduction, so every source pixel counts, as in 'scale.h'
+ */
+Bool render_composite(Display *display, Pixmap pixmap, Bool alpha,
+        unsigned int src_width, unsigned int src_height,
+        Drawable drawable, int x, int y,
+        unsigned int width, unsigned int height,
+        scale_filter_td filter);
+
+/**
+ * @brief Draw a string with the built-in font over a drawable of the
+ *        default visual
+ *
+ * @param display  Display where the drawable is
+ * @param drawable Destination drawable
+ * @param x        Text origin, left (px)
+ * @param y        Text origin, baseline (px)
+ * @param text     Text; other characters than printable ASCII are
+ *                 drawn as '?'
+ * @param length   Length of @p text (bytes)
+ * @param color    Text color, as 0xRRGGBB
+ *
+ * @return @c True if the text was sent, or @c False if RENDER is not
+ *         available, and then nothing is drawn
+ *
+ * @note The glyphs are sent once per display, the first time
+ */
+Bool render_text(Display *display, Drawable drawable, int x, int y,
+        const char *text, size_t length, unsigned long color);
+
+/**
+ * @brief Free the glyphs kept on the server for a display, if any
+ *
+ * @param display Display the glyphs were sent to
+ */
+void render_release(Display *display);
+
+
+#endif /* ! RENDER_H */
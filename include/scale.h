@@ -0,0 +1,148 @@
+/**
+ * @file scale.h
+ *
+ * @brief Client-side image scaling declaration
+ */
+/*
+ * ISC License
+ * Copyright (c) 2025, J. A. Corbal <jacorbal@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS.  IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS
+ * ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF
+ * THIS SOFTWARE.
+ */
+
+#ifndef SCALE_H
+#define SCALE_H
+
+/* Standard library includes */
+#include <stddef.h>     /* size_t */
+#include <stdint.h>     /* uint32_t */
+
+/* X includes */
+#include <X11/Xlib.h>   /* Display, XImage */
+
+
+/**
+ * @typedef scale_filter_td
+ *
+ * @brief Resampling filter used when scaling an image
+ */
+typedef enum {
+    SCALE_NEAREST,      /**< Nearest neighbour, fastest */
+    SCALE_BILINEAR,     /**< Bilinear interpolation, smooth upscaling */
+    SCALE_BOX,          /**< Box (area average), best for downscaling */
+} scale_filter_td;
+
+
+/* Prototypes */
+/**
+ * @brief Get a scaling filter from its name
+ *
+ * @param name   Filter name: "nearest", "bilinear" or "box"
+ * @param filter Where to store the filter if found
+ *
+ * @return @c True if the name is a known filter, or @c False otherwise
+ */
+Bool scale_filter_parse(const char *name, scale_filter_td *filter);
+
+/**
+ * @brief Scale a 32-bit per pixel buffer (four 8-bit channels)
+ *
+ * @param src        Source pixels
+ * @param src_width  Source width (px)
+ * @param src_height Source height (px)
+ * @param src_stride Source distance between rows (px)
+ * @param dst        Destination pixels
+ * @param dst_width  Destination width (px)
+ * @param dst_height Destination height (px)
+ * @param dst_stride Destination distance between rows (px)
+ * @param filter     Resampling filter
+ *
+ * @return 0 on success, or -1 if there was no memory for the kernels
+ *
+ * @note Channels are processed independently, so the byte layout of
+ *       the pixel is irrelevant as long as every channel is 8 bits wide
+ */
+int scale_rgb32(const uint32_t *src, unsigned int src_width,
+        unsigned int src_height, size_t src_stride,
+        uint32_t *dst, unsigned int dst_width,
+        unsigned int dst_height, size_t dst_stride,
+        scale_filter_td filter);
+
+/**
+ * @brief Get the source span covered by a span of a box-filtered
+ *        destination
+ *
+ * @param src_len   Source length (px)
+ * @param dst_len   Destination length (px)
+ * @param first     First destination coordinate
+ * @param count     Number of destination coordinates, at least 1
+ * @param src_first First source coordinate covered
+ * @param src_count Number of source coordinates covered
+ *
+ * @note Works on either axis; see @c scale_box_rect
+ */
+void scale_box_span(unsigned int src_len, unsigned int dst_len,
+        unsigned int first, unsigned int count,
+        unsigned int *src_first, unsigned int *src_count);
+
+/**
+ * @brief Box-filter a rectangle of the destination from its source area
+ *
+ * @param src        Source pixels, starting at the first pixel covered
+ *                   by the rectangle (see @c scale_box_span)
+ * @param src_stride Source distance between rows (px)
+ * @param src_width  Whole source width (px)
+ * @param src_height Whole source height (px)
+ * @param dst        Whole destination pixels
+ * @param dst_stride Destination distance between rows (px)
+ * @param dst_width  Whole destination width (px)
+ * @param dst_height Whole destination height (px)
+ * @param x          Rectangle left coordinate, in the destination
+ * @param y          Rectangle top coordinate, in the destination
+ * @param width      Rectangle width (px)
+ * @param height     Rectangle height (px)
+ *
+ * @return 0 on success, or -1 if there was no memory for the kernels
+ *
+ * @note The rectangle gets exactly the pixels a whole @c SCALE_BOX
+ *       scaling would give it, so parts of the destination can be
+ *       updated independently
+ */
+int scale_box_rect(const uint32_t *src, size_t src_stride,
+        unsigned int src_width, unsigned int src_height,
+        uint32_t *dst, size_t dst_stride,
+        unsigned int dst_width, unsigned int dst_height,
+        unsigned int x, unsigned int y,
+        unsigned int width, unsigned int height);
+
+/**
+ * @brief Scale a client-side image
+ *
+ * @param display Display the image belongs to
+ * @param image   Image to scale
+ * @param width   New image width (px)
+ * @param height  New image height (px)
+ * @param filter  Resampling filter
+ *
+ * @return New scaled image, or @c NULL if it cannot be allocated
+ *
+ * @note Visuals other than 24/32-bpp with 8-bit channels are always
+ *       scaled by using the nearest neighbour, whatever the filter
+ */
+XImage *image_scale(Display *display, XImage *image,
+        unsigned int width, unsigned int height,
+        scale_filter_td filter);
+
+
+#endif /* ! SCALE_H */
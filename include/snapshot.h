@@ -0,0 +1,128 @@
+/**
+ * @file snapshot.h
+ *
+ * @brief Thumbnails of the current contents of a window
+ *
+ * The window is read through its XComposite off-screen pixmap.  Parts
+ * of it obscured by other windows are only captured if a compositor
+ * already keeps it off-screen; otherwise, the pixmap is filled from the
+ * screen when it is redirected, obscuring windows included.  The
+ * capture is reduced to the icon size with a box filter on a worker
+ * thread, which announces the thumbnail with a client message to the
+ * icon window.
+ */
+/*
+ * ISC License
+ * Copyright (c) 2025, J. A. Corbal <jacorbal@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS.  IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS
+ * ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF
+ * THIS SOFTWARE.
+ */
+
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+/* Standard library includes */
+#include <pthread.h>    /* pthread_t */
+
+/* X includes */
+#include <X11/Xlib.h>   /* Atom, Bool, Display, Window, XImage */
+
+
+/**
+ * @typedef snapshot_td
+ *
+ * @brief Thumbnail being reduced on a worker thread
+ */
+typedef struct {
+    pthread_t thread;       /**< Worker thread */
+    Bool threaded;          /**< The worker thread was started */
+    Display *display;       /**< Display to notify through */
+    Window notify;          /**< Window the client message is sent to */
+    Atom message;           /**< Type of the client message */
+    XImage *capture;        /**< Window contents, full size, or already
+                                 reduced by the server */
+    XImage *thumbnail;      /**< Reduced contents, once done */
+    unsigned int src_width;     /**< Captured width (px) */
+    unsigned int src_height;    /**< Captured height (px) */
+    unsigned int width;     /**< Thumbnail width (px) */
+    unsigned int height;    /**< Thumbnail height (px) */
+} snapshot_td;
+
+
+/* Prototypes */
+/**
+ * @brief Capture the current contents of a window
+ *
+ * @param display    Display where the window is
+ * @param window     Window to capture, which must be viewable
+ * @param width      Thumbnail width (px)
+ * @param height     Thumbnail height (px)
+ * @param src_width  Where to store the window width (px)
+ * @param src_height Where to store the window height (px)
+ *
+ * @return Image of the window in the default depth, reduced to
+ *         @p width x @p height, or of the whole window; or @c NULL if
+ *         it cannot be captured
+ *
+ * @note With XComposite and RENDER, the server reduces the window (see
+ *       @c render_composite), and only the thumbnail is read back;
+ *       otherwise the whole window is read, and reduced by
+ *       @c snapshot_start
+ * @note Obscured parts of the window are only its own if a compositor
+ *       redirected it before; without XComposite, the window is read
+ *       directly, and obscured parts of it are undefined
+ */
+XImage *snapshot_capture(Display *display, Window window,
+        unsigned int width, unsigned int height,
+        unsigned int *src_width, unsigned int *src_height);
+
+/**
+ * @brief Start reducing a capture to a thumbnail
+ *
+ * @param display    Display to notify through
+ * @param capture    Captured contents; the snapshot takes ownership
+ * @param src_width  Window width (px)
+ * @param src_height Window height (px)
+ * @param width      Thumbnail width (px)
+ * @param height     Thumbnail height (px)
+ * @param notify     Window to send the client message to, once done
+ * @param message    Type of the client message
+ *
+ * @return New snapshot, or @c NULL if out of memory
+ *
+ * @note The worker thread uses @p display, so @c XInitThreads must have
+ *       been called before opening it; if the thread cannot be started,
+ *       or if the capture is already of the thumbnail size, it is
+ *       finished before returning
+ */
+snapshot_td *snapshot_start(Display *display, XImage *capture,
+        unsigned int src_width, unsigned int src_height,
+        unsigned int width, unsigned int height,
+        Window notify, Atom message);
+
+/**
+ * @brief Wait for a snapshot to finish and release it
+ *
+ * @param snapshot   Snapshot to finish
+ * @param src_width  Where to store the captured width (px), or @c NULL
+ * @param src_height Where to store the captured height (px), or @c NULL
+ *
+ * @return Thumbnail, to be destroyed by the caller, or @c NULL if it
+ *         could not be reduced
+ */
+XImage *snapshot_finish(snapshot_td *snapshot,
+        unsigned int *src_width, unsigned int *src_height);
+
+
+#endif /* ! SNAPSHOT_H */
@@ -0,0 +1,155 @@
+/**
+ * @file state.h
+ *
+ * @brief Icons of the daemon, kept across restarts in a mapped file
+ *
+ * Every icon of the daemon has a record in a file of fixed size, next to
+ * the icon cache and one per display, mapped in memory and shared with
+ * the file: a record is written in place when its icon is created or
+ * moved, and cleared when it is closed, with no system call but an
+ * asynchronous sync.  When the daemon starts, the icons whose windows
+ * still exist are made again from their records, where they were left
+ * and from the file they were loaded from, which is already cached.
+ *
+ * Every record holds a checksum of its fields: a record left half
+ * written by a crash is just ignored.
+ */
+/*
+ * ISC License
+ * Copyright (c) 2025, J. A. Corbal <jacorbal@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS.  IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS
+ * ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF
+ * THIS SOFTWARE.
+ */
+
+#ifndef STATE_H
+#define STATE_H
+
+/* Standard library includes */
+#include <stdint.h>     /* int32_t, uint8_t, uint32_t, uint64_t */
+
+/* X includes */
+#include <X11/Xlib.h>   /* Bool, Window */
+
+/* Local includes */
+#include <defaults.h>   /* MAX_APP_NAME_LENGTH */
+#include <iconify.h>    /* icon_td */
+
+
+/* Most icons kept; any other is not kept */
+#define STATE_SLOTS (256)
+
+/* Longest icon path kept (bytes); an icon from a longer one is not kept */
+#define STATE_PATH_LENGTH (512)
+
+
+/**
+ * @typedef state_record_td
+ *
+ * @brief What is kept of an icon, to make it again
+ *
+ * @note Fixed-width fields only, as it is the file format
+ * @note Each slot holds two copies; the whole one of the highest
+ *       generation is the record
+ */
+typedef struct {
+    uint64_t window;            /**< Original window, or 0 if free */
+    uint64_t class_key;         /**< Hash of its class and name */
+    uint64_t source_key;        /**< Key of the icon published by the
+                                     window, if it came from it */
+    int32_t x;                  /**< Icon left */
+    int32_t y;                  /**< Icon top */
+    int32_t x_anchor;           /**< Preferred left, to re-pack */
+    int32_t y_anchor;           /**< Preferred top, to re-pack */
+    int32_t orig_x;             /**< Window left, if kept out of sight */
+    int32_t orig_y;             /**< Window top, if kept out of sight */
+    uint32_t border;            /**< Icon border (px) */
+    uint32_t width;             /**< Icon width (px) */
+    uint32_t height;            /**< Icon height (px) */
+    uint32_t bg;                /**< Text background color */
+    uint32_t fg;                /**< Text foreground color */
+    uint32_t fc;                /**< Frame color */
+    uint32_t live_rate;         /**< Thumbnail refreshes per second */
+    uint8_t show_text;          /**< Display text under icon */
+    uint8_t snapshot;           /**< Show a snapshot of the window */
+    uint8_t filter;             /**< Scaling filter */
+    uint8_t source;             /**< Where the icon came from
+                                     (@c icon_source_td) */
+    char name[MAX_APP_NAME_LENGTH];     /**< Icon name */
+    char group[MAX_APP_NAME_LENGTH];    /**< Icon group, or empty */
+    char path[STATE_PATH_LENGTH];       /**< File the icon came from */
+    uint64_t generation;        /**< Count of writes to its slot */
+    uint64_t checksum;          /**< Hash of the fields above */
+} state_record_td;
+
+
+/* Prototypes */
+/**
+ * @brief Map the state file of the current display, creating it if
+ *        missing, or clearing it if not valid
+ *
+ * @return 0 on success, or -1 if it cannot be mapped; icons are then
+ *         not kept
+ */
+int state_open(void);
+
+/**
+ * @brief Unmap the state file; the records are left in it, for the next
+ *        run
+ */
+void state_close(void);
+
+/**
+ * @brief Get a record of the state file
+ *
+ * @param slot   Slot of the record, below @c STATE_SLOTS
+ * @param record Where to copy the record
+ *
+ * @return @c True if the slot holds a whole record, or @c False if it is
+ *         free, or if both its copies were left half written
+ */
+Bool state_get(unsigned int slot, state_record_td *record);
+
+/**
+ * @brief Hash of the class and name of a window, to tell it from a
+ *        window of another program that took its ID
+ *
+ * @param res_class Window class, or @c NULL
+ * @param res_name  Window resource name, or @c NULL
+ *
+ * @return Hash, as kept in the records
+ */
+uint64_t state_class_key(const char *res_class, const char *res_name);
+
+/**
+ * @brief Write the record of an icon, in the slot of its window if it
+ *        has one, or else in a free slot
+ *
+ * @param icon Icon, created and placed
+ *
+ * @note The record is written in place, so this is cheap enough to be
+ *       called on every move; it overwrites the older copy of the
+ *       slot, so that if the write is cut short, by a crash, the
+ *       previous record is still whole
+ */
+void state_save(const icon_td *icon);
+
+/**
+ * @brief Clear the record of a window, if any
+ *
+ * @param window Original window of an icon closed
+ */
+void state_forget(Window window);
+
+
+#endif /* ! STATE_H */
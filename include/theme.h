@@ -0,0 +1,90 @@
+/**
+ * @file theme.h
+ *
+ * @brief Icon lookup by name in the icon themes, through an index
+ *
+ * Icons are looked for, by name and size, in the user icon theme (the
+ * GTK one, if set), then in 'hicolor', and last in '/usr/share/pixmaps';
+ * every theme is searched in '~/.local/share/icons', '~/.icons' and the
+ * 'icons' directory of every '$XDG_DATA_DIRS'.
+ *
+ * Those directories are walked once, and every icon found is kept in a
+ * hash index, written next to the icon cache and mapped in memory by
+ * later runs: a lookup is a single hash probe, with no system calls.
+ * Opening it only looks at the theme roots, so that a theme created or
+ * removed is noticed at once.  The index also keeps every directory
+ * walked, with its modification time, and is rebuilt when any of them
+ * changes; as those are hundreds, they are checked at most once every
+ * few minutes, by any process.  The daemon watches them through inotify
+ * instead, and sees every change at once.
+ */
+/*
+ * ISC License
+ * Copyright (c) 2025, J. A. Corbal <jacorbal@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS.  IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS
+ * ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF
+ * THIS SOFTWARE.
+ */
+
+#ifndef THEME_H
+#define THEME_H
+
+/* Standard library includes */
+#include <stddef.h>     /* size_t */
+
+/* X includes */
+#include <X11/Xlib.h>   /* Bool */
+
+
+/* Prototypes */
+/**
+ * @brief Look for an icon by name
+ *
+ * @param name   Icon name, such as the window class; case is ignored
+ * @param size   Icon size (px), to pick the closest larger file
+ * @param path   Where to store the path of the icon file
+ * @param length Size of @p path
+ *
+ * @return @c True if an icon was found
+ *
+ * @note Only the formats 'imgfile.h' reads (XPM and XBM) are indexed
+ * @note The index is opened, or built, on the first lookup
+ */
+Bool theme_lookup(const char *name, unsigned int size,
+        char *path, size_t length);
+
+/**
+ * @brief Watch the theme directories for changes
+ *
+ * @return Descriptor to wait on for changes, or -1 if they cannot be
+ *         watched
+ *
+ * @note Call @c theme_changed when the descriptor is readable
+ */
+int theme_watch(void);
+
+/**
+ * @brief Take the changes of the theme directories
+ *
+ * @note The index is rebuilt on the next lookup, so that a burst of
+ *       changes costs a single rebuild
+ */
+void theme_changed(void);
+
+/**
+ * @brief Release the index, and stop watching
+ */
+void theme_release(void);
+
+
+#endif /* ! THEME_H */
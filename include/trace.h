@@ -0,0 +1,180 @@
+/**
+ * @file trace.h
+ *
+ * @brief Requests, round trips, flushes and time of every phase
+ *
+ * Every phase (loading, initialization, creation, drawing, event
+ * handling and restoring) counts the X requests it sends, the round
+ * trips it waits for, the times the output buffer is flushed, the bytes
+ * written to the connection, and its wall-clock time.  Handled events
+ * are also timed by type.  Counting is always on; it costs a clock read
+ * and a few additions per phase.
+ */
+/*
+ * ISC License
+ * Copyright (c) 2025, J. A. Corbal <jacorbal@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS.  IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS
+ * ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF
+ * THIS SOFTWARE.
+ */
+
+#ifndef TRACE_H
+#define TRACE_H
+
+/* Standard library includes */
+#include <stdio.h>      /* FILE */
+
+/* X includes */
+#include <X11/Xlib.h>   /* Bool, Display */
+
+
+/**
+ * @typedef trace_phase_td
+ *
+ * @brief Phases of the life of an icon
+ */
+typedef enum {
+    TRACE_INIT,         /**< Questions about the original window */
+    TRACE_LOAD,         /**< Icon decoding, scaling and upload */
+    TRACE_CREATE,       /**< Icon window creation, with its first paint */
+    TRACE_DRAW,         /**< Icon composition and copy to its window */
+    TRACE_EVENT,        /**< Handling of a single event */
+    TRACE_RESTORE,      /**< Original window mapped again */
+    TRACE_PHASES        /**< Number of phases */
+} trace_phase_td;
+
+/**
+ * @typedef trace_stats_td
+ *
+ * @brief Totals of a phase, or of an event type
+ */
+typedef struct {
+    unsigned long calls;            /**< Times it was run */
+    unsigned long long requests;    /**< X requests sent */
+    unsigned long long round_trips; /**< Replies waited for */
+    unsigned long long flushes;     /**< Writes to the connection */
+    unsigned long long bytes;       /**< Bytes written */
+    long long time;                 /**< Wall-clock time (us) */
+    long long time_max;             /**< Longest single run (us) */
+} trace_stats_td;
+
+/**
+ * @typedef trace_span_td
+ *
+ * @brief A phase in progress
+ */
+typedef struct {
+    Display *display;               /**< Display the phase talks to */
+    trace_phase_td phase;           /**< Phase in progress */
+    unsigned long request;          /**< Next request at the start */
+    unsigned long long round_trips; /**< Round trips at the start */
+    unsigned long long flushes;     /**< Flushes at the start */
+    unsigned long long bytes;       /**< Bytes at the start */
+    long long start;                /**< Time at the start (us) */
+} trace_span_td;
+
+
+/* Prototypes */
+/**
+ * @brief Start a phase
+ *
+ * @param span    Where to keep the phase in progress
+ * @param display Display the phase talks to
+ * @param phase   Phase to start
+ *
+ * @note Phases may nest (drawing happens inside creation and event
+ *       handling); each one counts everything until its end
+ */
+void trace_begin(trace_span_td *span, Display *display,
+        trace_phase_td phase);
+
+/**
+ * @brief End a phase, and add it to its totals
+ *
+ * @param span Phase in progress
+ */
+void trace_end(trace_span_td *span);
+
+/**
+ * @brief End the handling of an event, and add it to the totals of the
+ *        event handling phase and of its type
+ *
+ * @param span Event handling phase in progress
+ * @param type Type of the handled event
+ */
+void trace_end_event(trace_span_td *span, int type);
+
+/**
+ * @brief Count a round trip that Xlib does not see, such as the replies
+ *        of a batch of requests sent through XCB
+ *
+ * @param display Display the round trip was made on
+ *
+ * @note Every request with a reply sent through Xlib is counted by
+ *       itself, as Xlib waits for the reply (see @c _XReply)
+ */
+void trace_round_trip(Display *display);
+
+/**
+ * @brief Whether this build counts the round trips of Xlib
+ *
+ * @return @c True once a display is traced, if Xlib waits for replies
+ *         through the wrapper of 'trace.c'; if not, as with a static
+ *         Xlib, round trips are left at 0
+ */
+Bool trace_round_trips_counted(void);
+
+/**
+ * @brief Get the totals of a phase
+ *
+ * @param phase Phase to get
+ *
+ * @return Totals since the start
+ */
+const trace_stats_td *trace_stats(trace_phase_td phase);
+
+/**
+ * @brief Print the totals of every phase that was run, in a few lines
+ *
+ * @param fp Where to print
+ */
+void trace_print(FILE *fp);
+
+/**
+ * @brief Print the totals of every phase and event type, and the bytes
+ *        uploaded, as JSON
+ *
+ * @param fp Where to print
+ */
+void trace_print_json(FILE *fp);
+
+/**
+ * @brief Dump the totals as JSON whenever a signal is received
+ *
+ * @param signum Signal to take, usually @c SIGUSR1
+ *
+ * @note The handler only takes note; the totals are printed by the
+ *       next call to @c trace_dump_pending, from the event loop
+ */
+void trace_dump_install(int signum);
+
+/**
+ * @brief Print the totals as JSON, if the signal was received since the
+ *        last call
+ *
+ * @param fp Where to print
+ */
+void trace_dump_pending(FILE *fp);
+
+
+#endif /* ! TRACE_H */
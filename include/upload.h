@@ -0,0 +1,99 @@
+/**
+ * @file upload.h
+ *
+ * @brief Image uploads through MIT-SHM, or through the socket
+ *
+ * Large images are copied into a shared memory segment the X server
+ * reads directly, instead of being written to the socket and read back
+ * by the server.  Segments are kept in a small pool and reused once the
+ * server has processed the request that used them.  Remote displays,
+ * and servers without MIT-SHM, get plain @c XPutImage requests.
+ */
+/*
+ * ISC License
+ * Copyright (c) 2025, J. A. Corbal <jacorbal@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS.  IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS
+ * ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF
+ * THIS SOFTWARE.
+ */
+
+#ifndef UPLOAD_H
+#define UPLOAD_H
+
+/* Standard library includes */
+#include <stdio.h>      /* FILE */
+
+/* X includes */
+#include <X11/Xlib.h>   /* Display, Drawable, GC, XImage */
+
+
+/**
+ * @typedef upload_stats_td
+ *
+ * @brief Bytes uploaded by every path, since the start
+ */
+typedef struct {
+    unsigned long long shm_bytes;       /**< Bytes through MIT-SHM */
+    unsigned long long socket_bytes;    /**< Bytes through the socket */
+    unsigned long shm_count;            /**< Uploads through MIT-SHM */
+    unsigned long socket_count;         /**< Uploads through the socket */
+} upload_stats_td;
+
+
+/* Prototypes */
+/**
+ * @brief Upload a rectangle of an image into a drawable
+ *
+ * @param display  Display where the drawable is
+ * @param drawable Destination drawable
+ * @param gc       Graphics context of the depth of @p drawable
+ * @param image    Image to upload
+ * @param src_x    Left of the rectangle in the image (px)
+ * @param src_y    Top of the rectangle in the image (px)
+ * @param dst_x    Left of the rectangle in the drawable (px)
+ * @param dst_y    Top of the rectangle in the drawable (px)
+ * @param width    Rectangle width (px)
+ * @param height   Rectangle height (px)
+ *
+ * @note Same arguments and behaviour as @c XPutImage, which is used for
+ *       small rectangles, remote displays and unusual image formats
+ */
+void upload_image(Display *display, Drawable drawable, GC gc,
+        XImage *image, int src_x, int src_y, int dst_x, int dst_y,
+        unsigned int width, unsigned int height);
+
+/**
+ * @brief Release the shared memory segments of a display
+ *
+ * @param display Display the segments are attached to
+ *
+ * @note Call it before closing the display
+ */
+void upload_release(Display *display);
+
+/**
+ * @brief Get the bytes uploaded by every path
+ *
+ * @return Statistics since the start
+ */
+const upload_stats_td *upload_stats(void);
+
+/**
+ * @brief Print the bytes uploaded by every path, in a single line
+ *
+ * @param fp Where to print
+ */
+void upload_stats_print(FILE *fp);
+
+
+#endif /* ! UPLOAD_H */
@@ -0,0 +1,86 @@
+/**
+ * @file atoms.c
+ *
+ * @brief Atoms used by iconify, interned at once
+ */
+/*
+ * ISC License
+ * Copyright (c) 2025, J. A. Corbal <jacorbal@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS.  IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS
+ * ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF
+ * THIS SOFTWARE.
+ */
+
+/* Standard library includes */
+#include <string.h>     /* memcpy */
+
+/* X includes */
+#include <X11/Xlib.h>   /* Atom, Display, XInternAtoms */
+
+/* Local includes */
+#include <atoms.h>
+
+
+/* Atom names, in the same order as 'atom_td' */
+static const char *_atom_names[ATOM_COUNT] = {
+    "WM_DELETE_WINDOW",
+    "WM_CHANGE_STATE",
+    "_NET_WM_WINDOW_TYPE",
+    "_NET_WM_WINDOW_TYPE_DESKTOP",
+    "_NET_WM_STATE",
+    "_NET_WM_STATE_BELOW",
+    "_NET_WM_STATE_SKIP_TASKBAR",
+    "_NET_WM_STATE_SKIP_PAGER",
+    "_NET_WM_ICON",
+    "_NET_CLIENT_LIST",
+    "_ICONIFY_SNAPSHOT",
+};
+
+/* Atoms of the last display they were interned for */
+static Display *_atoms_display = NULL;
+static Atom _atoms[ATOM_COUNT];
+
+
+/* Get the table of atoms of a display */
+const Atom *atoms_get(Display *display)
+{
+    if (display != _atoms_display) {
+        XInternAtoms(display, (char **) _atom_names, ATOM_COUNT, False,
+                _atoms);
+        _atoms_display = display;
+    }
+
+    return _atoms;
+}
+
+
+/* Whether the atoms of a display are already interned */
+Bool atoms_ready(Display *display)
+{
+    return (display == _atoms_display) ? True : False;
+}
+
+
+/* Get the name of an atom */
+const char *atoms_name(atom_td atom)
+{
+    return _atom_names[atom];
+}
+
+
+/* Set the table of atoms of a display, interned elsewhere */
+void atoms_set(Display *display, const Atom *atoms)
+{
+    memcpy(_atoms, atoms, sizeof(_atoms));
+    _atoms_display = display;
+}
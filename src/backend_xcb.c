@@ -0,0 +1,240 @@
+/**
+ * @file backend_xcb.c
+ *
+ * @brief Queries to the X server through XCB, pipelined
+ *
+ * Every request is sent before waiting for the first reply, so the
+ * server answers all of them in a single round trip.  The requests go
+ * through the same connection as Xlib, so resources are shared.
+ */
+/*
+ * ISC License
+ * Copyright (c) 2025, J. A. Corbal <jacorbal@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS.  IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS
+ * ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF
+ * THIS SOFTWARE.
+ */
+
+/* Standard library includes */
+#include <stdlib.h>     /* free, malloc */
+#include <string.h>     /* memchr, memcpy, strlen */
+
+/* X includes */
+#include <X11/Xlib.h>       /* Atom, Display, Window */
+#include <X11/Xlib-xcb.h>   /* XGetXCBConnection */
+#include <xcb/xcb.h>        /* xcb_* */
+
+/* Local includes */
+#include <atoms.h>
+#include <backend.h>
+#include <defaults.h>
+#include <trace.h>
+
+
+/* Largest WM_CLASS property to read (in 32-bit units) */
+#define WM_CLASS_MAX_LENGTH (256)
+
+
+/* Copy a string of known length, which may not be terminated */
+static char *_string_copy(const char *string, size_t length)
+{
+    char *copy = malloc(length + 1);
+    if (copy) {
+        memcpy(copy, string, length);
+        copy[length] = '\0';
+    }
+    return copy;
+}
+
+
+/* Name of the backend, as chosen at build time */
+const char *backend_name(void)
+{
+    return "xcb";
+}
+
+
+/* WM_CLASS holds two consecutive strings: name and class */
+static void _class_read(xcb_get_property_reply_t *class_hint,
+        window_info_td *info)
+{
+    const char *value = xcb_get_property_value(class_hint);
+    size_t length = (size_t) xcb_get_property_value_length(class_hint);
+    const char *end = memchr(value, '\0', length);
+
+    if (length > 0 && class_hint->format == 8) {
+        size_t name_length = (end) ? (size_t) (end - value) : length;
+        info->res_name = _string_copy(value, name_length);
+        if (end && name_length + 1 < length) {
+            const char *class_name = end + 1;
+            size_t class_length = length - name_length - 1;
+            const char *class_end = memchr(class_name, '\0',
+                    class_length);
+            if (class_end) {
+                class_length = (size_t) (class_end - class_name);
+            }
+            info->res_class = _string_copy(class_name, class_length);
+        }
+    }
+}
+
+
+/* Keep the values of a '_NET_WM_ICON' reply */
+static void _icon_read(xcb_get_property_reply_t *icon, window_info_td *info)
+{
+    size_t length = (size_t) xcb_get_property_value_length(icon) /
+        sizeof(*info->icon);
+
+    if (icon->format == 32 && length > 0 &&
+            (info->icon = malloc(length * sizeof(*info->icon))) != NULL) {
+        memcpy(info->icon, xcb_get_property_value(icon),
+                length * sizeof(*info->icon));
+        info->icon_length = length;
+    }
+}
+
+
+/* Query everything iconify needs to know about a window */
+void window_info_get(Display *display, Window window, Bool icon,
+        window_info_td *info)
+{
+    window_info_get_all(display, &window, 1, &icon, info);
+}
+
+
+/* Query everything iconify needs to know about several windows */
+void window_info_get_all(Display *display, const Window *windows,
+        unsigned int count, const Bool *icons, window_info_td *infos)
+{
+    xcb_connection_t *connection = XGetXCBConnection(display);
+    xcb_intern_atom_cookie_t atom_cookies[ATOM_COUNT];
+    Bool atoms_needed = !atoms_ready(display);
+    xcb_translate_coordinates_cookie_t *position_cookies =
+        malloc(count * sizeof(*position_cookies));
+    xcb_get_property_cookie_t *class_cookies =
+        malloc(count * sizeof(*class_cookies));
+    xcb_get_property_cookie_t *icon_cookies =
+        malloc(count * sizeof(*icon_cookies));
+
+    for (unsigned int i = 0; i < count; ++i) {
+        infos[i].exists = False;
+        infos[i].x = infos[i].y = -1;
+        infos[i].res_name = NULL;
+        infos[i].res_class = NULL;
+        infos[i].icon_read = False;
+        infos[i].icon = NULL;
+        infos[i].icon_length = 0;
+    }
+    if (!position_cookies || !class_cookies || !icon_cookies) {
+        free(position_cookies);
+        free(class_cookies);
+        free(icon_cookies);
+        return;
+    }
+
+    /* Send every request first... */
+    if (atoms_needed) {
+        for (int i = 0; i < ATOM_COUNT; ++i) {
+            const char *name = atoms_name((atom_td) i);
+            atom_cookies[i] = xcb_intern_atom(connection, 0,
+                    (uint16_t) strlen(name), name);
+        }
+    }
+    for (unsigned int i = 0; i < count; ++i) {
+        position_cookies[i] = xcb_translate_coordinates(connection,
+                (xcb_window_t) windows[i],
+                (xcb_window_t) DefaultRootWindow(display), 0, 0);
+        class_cookies[i] = xcb_get_property(connection, 0,
+                (xcb_window_t) windows[i], XCB_ATOM_WM_CLASS,
+                XCB_ATOM_STRING, 0, WM_CLASS_MAX_LENGTH);
+    }
+
+    /* ...then collect the replies, that arrive together */
+    if (atoms_needed) {
+        Atom atoms[ATOM_COUNT];
+        for (int i = 0; i < ATOM_COUNT; ++i) {
+            xcb_intern_atom_reply_t *reply = xcb_intern_atom_reply(
+                    connection, atom_cookies[i], NULL);
+            atoms[i] = (reply) ? reply->atom : None;
+            free(reply);
+        }
+        atoms_set(display, atoms);
+    }
+
+    /* The icons, once their atom is known; they are sent before any
+     * reply about the windows is read, so they arrive with them */
+    Atom icon_atom = atoms_get(display)[ATOM_NET_WM_ICON];
+    Bool icons_sent = False;
+    for (unsigned int i = 0; i < count; ++i) {
+        infos[i].icon_read = (icons && icons[i] && icon_atom != None);
+        if (infos[i].icon_read) {
+            icon_cookies[i] = xcb_get_property(connection, 0,
+                    (xcb_window_t) windows[i], (xcb_atom_t) icon_atom,
+                    XCB_ATOM_CARDINAL, 0, MAX_NETWM_ICON_LENGTH);
+            icons_sent = True;
+        }
+    }
+
+    for (unsigned int i = 0; i < count; ++i) {
+        xcb_translate_coordinates_reply_t *position =
+            xcb_translate_coordinates_reply(connection,
+                    position_cookies[i], NULL);
+        if (position) {
+            infos[i].exists = True;
+            infos[i].x = position->dst_x;
+            infos[i].y = position->dst_y;
+            free(position);
+        }
+
+        xcb_get_property_reply_t *class_hint = xcb_get_property_reply(
+                connection, class_cookies[i], NULL);
+        if (class_hint) {
+            _class_read(class_hint, &infos[i]);
+            free(class_hint);
+        }
+
+        if (infos[i].icon_read) {
+            xcb_get_property_reply_t *icon = xcb_get_property_reply(
+                    connection, icon_cookies[i], NULL);
+            if (icon) {
+                _icon_read(icon, &infos[i]);
+                free(icon);
+            }
+        }
+    }
+    free(position_cookies);
+    free(class_cookies);
+    free(icon_cookies);
+
+    /* Not seen by Xlib: a single wait for the whole batch, and another
+     * one for the icons sent once their atom was known */
+    if (count > 0 || atoms_needed) {
+        trace_round_trip(display);
+    }
+    if (atoms_needed && icons_sent) {
+        trace_round_trip(display);
+    }
+}
+
+
+/* Release the strings and the icon of a window information */
+void window_info_free(window_info_td *info)
+{
+    free(info->res_name);
+    free(info->res_class);
+    free(info->icon);
+    info->res_name = NULL;
+    info->res_class = NULL;
+    info->icon = NULL;
+    info->icon_length = 0;
+}
@@ -0,0 +1,109 @@
+/**
+ * @file backend_xlib.c
+ *
+ * @brief Queries to the X server through Xlib, one at a time
+ */
+/*
+ * ISC License
+ * Copyright (c) 2025, J. A. Corbal <jacorbal@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS.  IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS
+ * ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF
+ * THIS SOFTWARE.
+ */
+
+/* Enable features from the POSIX.1-2008 standard */
+#define _POSIX_C_SOURCE 200809L
+
+/* Standard library includes */
+#include <stdlib.h>     /* free */
+#include <string.h>     /* strdup (POSIX.1-2008) */
+
+/* X includes */
+#include <X11/Xlib.h>   /* Display, Window, X* */
+#include <X11/Xutil.h>  /* XClassHint, XGetClassHint */
+
+/* Local includes */
+#include <atoms.h>
+#include <backend.h>
+#include <netwm.h>
+
+
+/* Name of the backend, as chosen at build time */
+const char *backend_name(void)
+{
+    return "xlib";
+}
+
+
+/* Query everything iconify needs to know about a window */
+void window_info_get(Display *display, Window window, Bool icon,
+        window_info_td *info)
+{
+    XClassHint class_hint;
+    Window child;
+
+    info->exists = False;
+    info->x = info->y = -1;
+    info->res_name = NULL;
+    info->res_class = NULL;
+    info->icon_read = False;
+    info->icon = NULL;
+    info->icon_length = 0;
+
+    /* Interned once per display */
+    atoms_get(display);
+
+    /* Absolute coordinates; fails if the window does not exist */
+    if (!XTranslateCoordinates(display, window,
+                DefaultRootWindow(display), 0, 0, &info->x, &info->y,
+                &child)) {
+        return;
+    }
+    info->exists = True;
+
+    if (XGetClassHint(display, window, &class_hint)) {
+        info->res_name = strdup(class_hint.res_name);
+        info->res_class = strdup(class_hint.res_class);
+        XFree(class_hint.res_name);
+        XFree(class_hint.res_class);
+    }
+    if (icon) {
+        info->icon = netwm_icon_read(display, window, &info->icon_length);
+        info->icon_read = True;
+    }
+}
+
+
+/* Query everything iconify needs to know about several windows; one
+ * window after the other, as Xlib waits for every answer anyway */
+void window_info_get_all(Display *display, const Window *windows,
+        unsigned int count, const Bool *icons, window_info_td *infos)
+{
+    for (unsigned int i = 0; i < count; ++i) {
+        window_info_get(display, windows[i], (icons) ? icons[i] : False,
+                &infos[i]);
+    }
+}
+
+
+/* Release the strings and the icon of a window information */
+void window_info_free(window_info_td *info)
+{
+    free(info->res_name);
+    free(info->res_class);
+    free(info->icon);
+    info->res_name = NULL;
+    info->res_class = NULL;
+    info->icon = NULL;
+    info->icon_length = 0;
+}
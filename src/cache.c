@@ -0,0 +1,399 @@
+/**
+ * @file cache.c
+ *
+ * @brief Persistent cache of decoded and scaled icons
+ *
+ * Each entry is a file with a fixed header, the source path, and then
+ * the image data exactly as @c XPutImage expects it.  Entries are
+ * written to a temporary file first and then renamed, so a reader never
+ * sees a partially written entry, even after a crash.
+ */
+/*
+ * ISC License
+ * Copyright (c) 2025, J. A. Corbal <jacorbal@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS.  IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS
+ * ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF
+ * THIS SOFTWARE.
+ */
+
+/* Enable features from the POSIX.1-2008 standard */
+#define _POSIX_C_SOURCE 200809L
+
+/* Standard library includes */
+#include <fcntl.h>      /* open, O_* */
+#include <stdint.h>     /* uint32_t, uint64_t */
+#include <stdio.h>      /* snprintf */
+#include <stdlib.h>     /* getenv */
+#include <string.h>     /* memcmp, memcpy, memset, strlen */
+#include <sys/mman.h>   /* mmap, munmap */
+#include <sys/stat.h>   /* fstat, mkdir */
+#include <unistd.h>     /* access, close, getpid, rename, unlink, write */
+
+/* X includes */
+#include <X11/Xlib.h>   /* Display, Pixmap, XImage, X*, *SBFirst */
+#include <X11/Xutil.h>  /* XDestroyImage */
+
+/* Local includes */
+#include <cache.h>
+#include <defaults.h>
+#include <pixbuf.h>
+#include <upload.h>
+
+
+/* Cache entry format */
+#define CACHE_MAGIC "ICONIFY\0"
+#define CACHE_VERSION (3)     /* 3: stamp of the source and variants */
+
+
+/**
+ * @typedef cache_header_td
+ *
+ * @brief Header of a cache entry, followed by the source path, or the
+ *        name of the icon of a window, and, at the next multiple of 8
+ *        bytes, by the image data
+ */
+typedef struct {
+    char magic[8];              /**< @c CACHE_MAGIC */
+    uint32_t version;           /**< @c CACHE_VERSION */
+    uint32_t path_length;       /**< Source path length, without NUL */
+    uint64_t stamp;             /**< Stamp of the source and of its
+                                     variants, or key of the icon of a
+                                     window */
+    uint32_t width;             /**< Image width (px) */
+    uint32_t height;            /**< Image height (px) */
+    uint32_t depth;             /**< Image depth (bits) */
+    uint32_t bits_per_pixel;    /**< Image bits per pixel */
+    uint32_t bytes_per_line;    /**< Image bytes per line */
+    uint32_t byte_order;        /**< Image byte order */
+    uint32_t filter;            /**< Filter used to scale the image */
+    uint32_t reserved;          /**< Padding, always 0 */
+} cache_header_td;
+
+
+/* Offset of the image data in an entry */
+static size_t _data_offset(size_t path_length)
+{
+    return (sizeof(cache_header_td) + path_length + 7) & ~(size_t) 7;
+}
+
+
+/* Hash (FNV-1a, 64 bits) of a byte sequence, continuing a hash */
+static uint64_t _hash(uint64_t hash, const void *data, size_t length)
+{
+    const unsigned char *bytes = data;
+    for (size_t i = 0; i < length; ++i) {
+        hash = (hash ^ bytes[i]) * 0x100000001B3ull;
+    }
+    return hash;
+}
+
+
+/* Create a directory and its missing parents */
+static int _directory_make(char *path)
+{
+    for (char *c = path + 1; *c; ++c) {
+        if (*c == '/') {
+            *c = '\0';
+            mkdir(path, 0700);
+            *c = '/';
+        }
+    }
+    return (mkdir(path, 0700) == 0 || access(path, W_OK) == 0) ? 0 : -1;
+}
+
+
+/* Get the directory of the cache, creating it if asked to */
+int cache_directory(char *buffer, size_t size, Bool create)
+{
+    const char *cache_home = getenv("XDG_CACHE_HOME");
+    const char *home = getenv("HOME");
+    int length;
+
+    if (cache_home && cache_home[0] == '/') {
+        length = snprintf(buffer, size, "%s/%s", cache_home,
+                DEFAULT_CACHE_NAME);
+    } else if (home && home[0] == '/') {
+        length = snprintf(buffer, size, "%s/.cache/%s", home,
+                DEFAULT_CACHE_NAME);
+    } else {
+        return -1;
+    }
+    if (length < 0 || (size_t) length >= size) {
+        return -1;
+    }
+
+    return (create) ? _directory_make(buffer) : 0;
+}
+
+
+/* Get the path of the entry for an icon in a given pixel format */
+static int _entry_path(char *buffer, size_t size, const char *path,
+        unsigned int width, unsigned int height, int filter,
+        unsigned int depth, Bool create)
+{
+    char directory[MAX_PATH_LENGTH];
+    uint32_t key[4] = {
+        width, height, (uint32_t) filter, depth
+    };
+    uint64_t hash = 0xCBF29CE484222325ull;
+
+    if (cache_directory(directory, sizeof(directory), create) != 0) {
+        return -1;
+    }
+    hash = _hash(hash, path, strlen(path));
+    hash = _hash(hash, key, sizeof(key));
+
+    int length = snprintf(buffer, size, "%s/%016llx", directory,
+            (unsigned long long) hash);
+
+    return (length < 0 || (size_t) length >= size) ? -1 : 0;
+}
+
+
+/* Create a pixmap from the cached icon of a file */
+Pixmap cache_pixmap_load(Display *display, const char *path,
+        uint64_t stamp, unsigned int width, unsigned int height,
+        int filter)
+{
+    int screen = DefaultScreen(display);
+    unsigned int depth = (unsigned int) DefaultDepth(display, screen);
+    char entry[MAX_PATH_LENGTH];
+    struct stat status;
+    Pixmap pixmap = None;
+
+    if (_entry_path(entry, sizeof(entry), path, width, height,
+                filter, depth, False) != 0) {
+        return None;
+    }
+
+    int fd = open(entry, O_RDONLY);
+    if (fd < 0) {
+        return None;
+    }
+    if (fstat(fd, &status) != 0 ||
+            (size_t) status.st_size < sizeof(cache_header_td)) {
+        close(fd);
+        return None;
+    }
+
+    size_t mapping_size = (size_t) status.st_size;
+    void *mapping = mmap(NULL, mapping_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED) {
+        return None;
+    }
+
+    /* Check the entry is complete, and still matches its source */
+    const cache_header_td *header = mapping;
+    size_t path_length = strlen(path);
+    size_t offset = _data_offset(path_length);
+    if (memcmp(header->magic, CACHE_MAGIC, sizeof(header->magic)) != 0 ||
+            header->version != CACHE_VERSION ||
+            header->path_length != path_length ||
+            mapping_size < offset ||
+            memcmp((const char *) mapping + sizeof(*header), path,
+                path_length) != 0 ||
+            header->stamp != stamp ||
+            header->width != width || header->height != height ||
+            header->depth != depth ||
+            header->filter != (uint32_t) filter ||
+            mapping_size - offset <
+                (size_t) header->bytes_per_line * header->height) {
+        munmap(mapping, mapping_size);
+        return None;
+    }
+
+    /* Wrap the mapped data, as is, in an image; it must be in the
+     * format Xlib would choose for this display */
+    XImage *image = XCreateImage(display, DefaultVisual(display, screen),
+            depth, ZPixmap, 0, (char *) mapping + offset, width, height,
+            32/*bits*/, (int) header->bytes_per_line);
+    if (image && (uint32_t) image->bits_per_pixel ==
+                header->bits_per_pixel &&
+            (uint32_t) image->byte_order == header->byte_order) {
+        pixmap = XCreatePixmap(display, RootWindow(display, screen),
+                width, height, depth);
+        upload_image(display, pixmap, DefaultGC(display, screen),
+                image, 0, 0, 0, 0, width, height);
+    }
+    if (image) {
+        image->data = NULL;     /* Not owned by the image */
+        XDestroyImage(image);
+    }
+    munmap(mapping, mapping_size);
+
+    return pixmap;
+}
+
+
+/* Write an entry to a temporary file, and only rename it once complete */
+static void _entry_write(const char *entry, const cache_header_td *header,
+        const char *path, const void *data, size_t data_length)
+{
+    char temporary[MAX_PATH_LENGTH + 32];
+    static const char padding[8] = { 0 };
+    size_t path_length = header->path_length;
+
+    snprintf(temporary, sizeof(temporary), "%s.%ld", entry,
+            (long) getpid());
+    int fd = open(temporary, O_WRONLY | O_CREAT | O_TRUNC, 0600);
+    if (fd < 0) {
+        return;
+    }
+    size_t padding_length = _data_offset(path_length) -
+        sizeof(*header) - path_length;
+    Bool written =
+        write(fd, header, sizeof(*header)) == (ssize_t) sizeof(*header) &&
+        write(fd, path, path_length) == (ssize_t) path_length &&
+        write(fd, padding, padding_length) == (ssize_t) padding_length &&
+        write(fd, data, data_length) == (ssize_t) data_length;
+    if (close(fd) != 0 || !written ||
+            rename(temporary, entry) != 0) {
+        unlink(temporary);
+    }
+}
+
+
+/* Store the decoded and scaled icon of a file */
+void cache_image_store(Display *display, const char *path,
+        uint64_t stamp, const XImage *image, int filter)
+{
+    char entry[MAX_PATH_LENGTH];
+    cache_header_td header;
+
+    (void) display;
+    if (_entry_path(entry, sizeof(entry), path,
+                (unsigned int) image->width, (unsigned int) image->height,
+                filter, (unsigned int) image->depth, True) != 0) {
+        return;
+    }
+
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, CACHE_MAGIC, sizeof(header.magic));
+    header.version = CACHE_VERSION;
+    header.path_length = (uint32_t) strlen(path);
+    header.stamp = stamp;
+    header.width = (uint32_t) image->width;
+    header.height = (uint32_t) image->height;
+    header.depth = (uint32_t) image->depth;
+    header.bits_per_pixel = (uint32_t) image->bits_per_pixel;
+    header.bytes_per_line = (uint32_t) image->bytes_per_line;
+    header.byte_order = (uint32_t) image->byte_order;
+    header.filter = (uint32_t) filter;
+
+    _entry_write(entry, &header, path, image->data,
+            (size_t) image->bytes_per_line * (size_t) image->height);
+}
+
+
+/* Byte order of the pixels of a pixel buffer, those of this machine */
+static inline uint32_t _pixbuf_byte_order(void)
+{
+    const uint32_t one = 1;
+    return (*(const unsigned char *) &one) ? LSBFirst : MSBFirst;
+}
+
+
+/* Name of the entry of the icon published by a window, in place of the
+ * path of a file: it has none */
+static void _pixbuf_name(char *buffer, size_t size, uint64_t key)
+{
+    snprintf(buffer, size, "_NET_WM_ICON:%016llx", (unsigned long long) key);
+}
+
+
+/* Get the icon published by a window, as stored by a previous run */
+pixbuf_td *cache_pixbuf_load(uint64_t key)
+{
+    char name[32];
+    char entry[MAX_PATH_LENGTH];
+    struct stat status;
+    pixbuf_td *pixbuf = NULL;
+
+    _pixbuf_name(name, sizeof(name), key);
+    if (_entry_path(entry, sizeof(entry), name, 0, 0, 0, 32/*ARGB*/,
+                False) != 0) {
+        return NULL;
+    }
+    int fd = open(entry, O_RDONLY);
+    if (fd < 0) {
+        return NULL;
+    }
+    if (fstat(fd, &status) != 0 ||
+            (size_t) status.st_size < sizeof(cache_header_td)) {
+        close(fd);
+        return NULL;
+    }
+
+    size_t mapping_size = (size_t) status.st_size;
+    void *mapping = mmap(NULL, mapping_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED) {
+        return NULL;
+    }
+
+    /* Check the entry is complete, and holds these very pixels */
+    const cache_header_td *header = mapping;
+    size_t name_length = strlen(name);
+    size_t offset = _data_offset(name_length);
+    if (memcmp(header->magic, CACHE_MAGIC, sizeof(header->magic)) == 0 &&
+            header->version == CACHE_VERSION &&
+            header->path_length == name_length &&
+            header->stamp == key &&
+            mapping_size >= offset &&
+            memcmp((const char *) mapping + sizeof(*header), name,
+                name_length) == 0 &&
+            header->width > 0 && header->height > 0 &&
+            header->depth == 32 && header->bits_per_pixel == 32 &&
+            header->bytes_per_line == header->width * 4 &&
+            header->byte_order == _pixbuf_byte_order() &&
+            mapping_size - offset >=
+                (size_t) header->bytes_per_line * header->height &&
+            (pixbuf = pixbuf_new(header->width, header->height)) != NULL) {
+        memcpy(pixbuf->data, (const char *) mapping + offset,
+                (size_t) header->bytes_per_line * header->height);
+    }
+    munmap(mapping, mapping_size);
+
+    return pixbuf;
+}
+
+
+/* Store the icon published by a window, unless already stored */
+void cache_pixbuf_store(uint64_t key, const pixbuf_td *pixbuf)
+{
+    char name[32];
+    char entry[MAX_PATH_LENGTH];
+    cache_header_td header;
+
+    _pixbuf_name(name, sizeof(name), key);
+    if (_entry_path(entry, sizeof(entry), name, 0, 0, 0, 32/*ARGB*/,
+                True) != 0 || access(entry, F_OK) == 0) {
+        return;
+    }
+
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, CACHE_MAGIC, sizeof(header.magic));
+    header.version = CACHE_VERSION;
+    header.path_length = (uint32_t) strlen(name);
+    header.stamp = key;
+    header.width = pixbuf->width;
+    header.height = pixbuf->height;
+    header.depth = 32;
+    header.bits_per_pixel = 32;
+    header.bytes_per_line = pixbuf->width * 4;
+    header.byte_order = _pixbuf_byte_order();
+
+    _entry_write(entry, &header, name, pixbuf->data,
+            (size_t) header.bytes_per_line * pixbuf->height);
+}
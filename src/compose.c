@@ -0,0 +1,312 @@
+/**
+ * @file compose.c
+ *
+ * @brief Icon composition in client memory implementation
+ */
+/*
+ * ISC License
+ * Copyright (c) 2025, J. A. Corbal <jacorbal@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS.  IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS
+ * ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF
+ * THIS SOFTWARE.
+ */
+
+/* Standard library includes */
+#include <stdint.h>     /* uint32_t */
+#include <stdio.h>      /* FILE, fclose, fopen, fprintf, fwrite */
+#include <stdlib.h>     /* free, malloc */
+#include <string.h>     /* memcpy, strcmp, strlen */
+
+/* Local includes */
+#include <compose.h>
+#include <defaults.h>
+#include <font.h>
+#include <iconify.h>
+#include <pixbuf.h>
+#include <scale.h>
+
+
+/* White, as the area behind the icon */
+#define COMPOSE_WHITE (0xFFFFFFu)
+
+/* End of a caption that does not fit */
+#define COMPOSE_ELLIPSIS "..."
+
+
+/* Fill a rectangle with an opaque color, clipped to the buffer */
+static void _rect_fill(pixbuf_td *pixbuf, int x, int y,
+        unsigned int width, unsigned int height, unsigned long color)
+{
+    uint32_t pixel = 0xFF000000u | ((uint32_t) color & 0x00FFFFFFu);
+    long x0 = (x < 0) ? 0 : x;
+    long y0 = (y < 0) ? 0 : y;
+    long x1 = (long) x + (long) width;
+    long y1 = (long) y + (long) height;
+
+    x1 = (x1 > (long) pixbuf->width) ? (long) pixbuf->width : x1;
+    y1 = (y1 > (long) pixbuf->height) ? (long) pixbuf->height : y1;
+    for (long row = y0; row < y1; ++row) {
+        uint32_t *dst = pixbuf->data + (size_t) row * pixbuf->width;
+        for (long col = x0; col < x1; ++col) {
+            dst[col] = pixel;
+        }
+    }
+}
+
+
+/* Blend an image, already at size, over an opaque area */
+static void _image_blend(pixbuf_td *pixbuf, const pixbuf_td *image,
+        int x, int y)
+{
+    for (unsigned int row = 0; row < image->height; ++row) {
+        long dst_y = (long) y + row;
+        if (dst_y < 0 || dst_y >= (long) pixbuf->height) {
+            continue;
+        }
+        const uint32_t *src = image->data + (size_t) row * image->width;
+        uint32_t *dst = pixbuf->data + (size_t) dst_y * pixbuf->width;
+        for (unsigned int col = 0; col < image->width; ++col) {
+            long dst_x = (long) x + col;
+            if (dst_x < 0 || dst_x >= (long) pixbuf->width) {
+                continue;
+            }
+            uint32_t s = src[col], d = dst[dst_x];
+            uint32_t a = s >> 24;
+            uint32_t pixel = 0xFF000000u;
+            for (int shift = 0; shift < 24; shift += 8) {
+                uint32_t sc = (s >> shift) & 0xFF, dc = (d >> shift) & 0xFF;
+                pixel |= ((sc * a + dc * (255 - a) + 127) / 255) << shift;
+            }
+            dst[dst_x] = pixel;
+        }
+    }
+}
+
+
+/* Multiply two 8 bits values as fractions of 255, rounded as the X
+ * server does */
+static inline uint32_t _mul_un8(uint32_t a, uint32_t b)
+{
+    uint32_t t = a * b + 0x80;
+
+    return ((t >> 8) + t) >> 8;
+}
+
+
+/* Draw a string with the built-in font, clipped to the buffer; other
+ * characters than printable ASCII are drawn as '?'.  The coverage of the
+ * glyphs is blended as the X server composes a solid color over its
+ * glyphs, so that both renderers give the same pixels */
+static void _text_draw(pixbuf_td *pixbuf, int x, int y, const char *text,
+        unsigned long color)
+{
+    uint32_t pixel = 0xFF000000u | ((uint32_t) color & 0x00FFFFFFu);
+    int top = y - FONT_ASCENT;
+
+    for (const unsigned char *c = (const unsigned char *) text; *c;
+            ++c, x += FONT_WIDTH) {
+        unsigned int index = (*c >= FONT_FIRST && *c <= FONT_LAST) ?
+            *c - FONT_FIRST : '?' - FONT_FIRST;
+        for (int row = 0; row < FONT_HEIGHT; ++row) {
+            long dst_y = (long) top + row;
+            if (dst_y < 0 || dst_y >= (long) pixbuf->height) {
+                continue;
+            }
+            const unsigned char *glyph = font_glyphs[index][row];
+            uint32_t *dst = pixbuf->data + (size_t) dst_y * pixbuf->width;
+            for (int col = 0; col < FONT_WIDTH; ++col) {
+                long dst_x = (long) x + col;
+                uint32_t alpha = glyph[col];
+                if (!alpha || dst_x < 0 || dst_x >= (long) pixbuf->width) {
+                    continue;
+                }
+                uint32_t blended = 0;
+                for (int shift = 0; shift < 32; shift += 8) {
+                    uint32_t channel = _mul_un8((pixel >> shift) & 0xFF,
+                            alpha) + _mul_un8((dst[dst_x] >> shift) & 0xFF,
+                            0xFF - alpha);
+                    blended |= channel << shift;
+                }
+                dst[dst_x] = blended;
+            }
+        }
+    }
+}
+
+
+/* Compute the layout of the icon window */
+void compose_layout(const icon_td *icon, compose_layout_td *layout)
+{
+    unsigned int caption = (icon->show_text) ? DEFAULT_TEXT_HEIGHT : 0;
+
+    layout->width = icon->width + 2 * icon->border;
+    layout->height = icon->height + caption + 2 * icon->border;
+    layout->inner_x = (int) icon->border;
+    layout->inner_y = (int) icon->border;
+    layout->inner_width = icon->width;
+    layout->inner_height = icon->height + caption;
+    layout->icon_x = (int) icon->border;
+    layout->icon_y = (int) icon->border;
+    layout->icon_width = icon->width;
+    layout->icon_height = icon->height;
+    layout->caption_x = (int) icon->border;
+    layout->caption_y = (int) (icon->height + icon->border);
+    layout->caption_width = (caption > 0) ? icon->width : 0;
+    layout->caption_height = caption;
+    layout->text_x = DEFAULT_TEXT_LOFFSET + (int) icon->border;
+    layout->text_y = (int) (icon->height + icon->border) +
+        DEFAULT_TEXT_VOFFSET;
+}
+
+
+/* Lay out a caption: the name, cut and ended with an ellipsis if it
+ * does not fit */
+char *compose_caption(const char *name, unsigned int width)
+{
+    size_t ellipsis = strlen(COMPOSE_ELLIPSIS);
+    size_t room = (width > 2 * DEFAULT_TEXT_LOFFSET) ?
+        (width - 2 * DEFAULT_TEXT_LOFFSET) / FONT_WIDTH : 0;
+    size_t length = strlen(name);
+    char *caption;
+
+    if (length <= room) {
+        caption = malloc(length + 1);
+        if (caption) {
+            memcpy(caption, name, length + 1);
+        }
+        return caption;
+    }
+
+    /* As much of the name as fits along with the ellipsis, without the
+     * spaces it would end with; or just what fits, if that is all */
+    caption = malloc(room + 1);
+    if (!caption) {
+        return NULL;
+    }
+    if (room <= ellipsis) {
+        memcpy(caption, name, room);
+        caption[room] = '\0';
+        return caption;
+    }
+    length = room - ellipsis;
+    while (length > 0 && name[length - 1] == ' ') {
+        --length;
+    }
+    memcpy(caption, name, length);
+    memcpy(caption + length, COMPOSE_ELLIPSIS, ellipsis + 1);
+
+    return caption;
+}
+
+
+/* Compose the icon window in a pixel buffer */
+pixbuf_td *compose_icon(const icon_td *icon, const pixbuf_td *image)
+{
+    compose_layout_td layout;
+
+    compose_layout(icon, &layout);
+    pixbuf_td *pixbuf = pixbuf_new(layout.width, layout.height);
+    if (!pixbuf) {
+        return NULL;
+    }
+
+    /* Border, or just white if there is no border */
+    _rect_fill(pixbuf, 0, 0, layout.width, layout.height,
+            (icon->border > 0) ? icon->fc : COMPOSE_WHITE);
+    if (icon->border > 0) {
+        _rect_fill(pixbuf, layout.inner_x, layout.inner_y,
+                layout.inner_width, layout.inner_height, COMPOSE_WHITE);
+    }
+
+    /* Icon, scaled first unless already at size */
+    if (image && image->width == layout.icon_width &&
+            image->height == layout.icon_height) {
+        _image_blend(pixbuf, image, layout.icon_x, layout.icon_y);
+    } else if (image) {
+        pixbuf_td *scaled = pixbuf_scale(image, layout.icon_width,
+                layout.icon_height, icon->filter);
+        if (!scaled) {
+            pixbuf_destroy(pixbuf);
+            return NULL;
+        }
+        _image_blend(pixbuf, scaled, layout.icon_x, layout.icon_y);
+        pixbuf_destroy(scaled);
+    }
+
+    /* Caption background and text */
+    if (layout.caption_height > 0) {
+        _rect_fill(pixbuf, layout.caption_x, layout.caption_y,
+                layout.caption_width, layout.caption_height, icon->bg);
+        char *caption = (icon->prog_name) ?
+            compose_caption(icon->prog_name, layout.caption_width) : NULL;
+        if (caption) {
+            _text_draw(pixbuf, layout.text_x, layout.text_y, caption,
+                    icon->fg);
+            free(caption);
+        }
+    }
+
+    return pixbuf;
+}
+
+
+/* Write a pixel buffer to a file */
+int compose_write(const pixbuf_td *pixbuf, const char *path)
+{
+    size_t length = strlen(path);
+    int pam = (length >= 4 && strcmp(path + length - 4, ".pam") == 0);
+    size_t channels = (pam) ? 4 : 3;
+
+    unsigned char *row = malloc(pixbuf->width * channels);
+    if (!row) {
+        return -1;
+    }
+    FILE *fp = fopen(path, "wb");
+    if (!fp) {
+        fprintf(stderr, "Cannot write '%s'\n", path);
+        free(row);
+        return -1;
+    }
+
+    if (pam) {
+        fprintf(fp, "P7\nWIDTH %u\nHEIGHT %u\nDEPTH 4\nMAXVAL 255\n"
+                "TUPLTYPE RGB_ALPHA\nENDHDR\n",
+                pixbuf->width, pixbuf->height);
+    } else {
+        fprintf(fp, "P6\n%u %u\n255\n", pixbuf->width, pixbuf->height);
+    }
+
+    int rc = 0;
+    for (unsigned int y = 0; y < pixbuf->height && rc == 0; ++y) {
+        const uint32_t *src = pixbuf->data + (size_t) y * pixbuf->width;
+        unsigned char *dst = row;
+        for (unsigned int x = 0; x < pixbuf->width; ++x) {
+            *dst++ = (unsigned char) (src[x] >> 16);
+            *dst++ = (unsigned char) (src[x] >> 8);
+            *dst++ = (unsigned char) src[x];
+            if (pam) {
+                *dst++ = (unsigned char) (src[x] >> 24);
+            }
+        }
+        if (fwrite(row, channels, pixbuf->width, fp) != pixbuf->width) {
+            rc = -1;
+        }
+    }
+    free(row);
+    if (fclose(fp) != 0 || rc != 0) {
+        fprintf(stderr, "Cannot write '%s'\n", path);
+        return -1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,1042 @@
+/**
+ * @file daemon.c
+ *
+ * @brief Iconify daemon implementation
+ */
+/*
+ * ISC License
+ * Copyright (c) 2025, J. A. Corbal <jacorbal@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS.  IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS
+ * ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF
+ * THIS SOFTWARE.
+ */
+
+/* Enable features from the POSIX.1-2008 standard, and the credentials
+ * of socket peers, from Linux */
+#define _POSIX_C_SOURCE 200809L
+#define _GNU_SOURCE
+
+/* Standard library includes */
+#include <errno.h>      /* errno, EINTR */
+#include <poll.h>       /* poll, pollfd, POLLIN */
+#include <signal.h>     /* sigaction, sig_atomic_t, SIG* */
+#include <stdio.h>      /* fprintf, snprintf */
+#include <stdlib.h>     /* calloc, free, getenv, malloc, qsort */
+#include <string.h>     /* memset, strcmp, strdup, strlen */
+#include <sys/socket.h> /* accept, bind, connect, listen, socket, ucred */
+#include <sys/stat.h>   /* umask */
+#include <sys/time.h>   /* timeval */
+#include <sys/un.h>     /* sockaddr_un */
+#include <unistd.h>     /* close, getuid, read, unlink, write */
+
+/* X includes */
+#include <X11/Xlib.h>   /* Display, Window, XEvent, X* */
+
+/* Local includes */
+#include <backend.h>
+#include <compose.h>
+#include <daemon.h>
+#include <defaults.h>
+#include <iconify.h>
+#include <monitors.h>
+#include <netwm.h>
+#include <place.h>
+#include <scale.h>
+#include <state.h>
+#include <theme.h>
+#include <trace.h>
+#include <upload.h>
+
+
+/**
+ * @typedef table_td
+ *
+ * @brief Icons managed by the daemon, hashed by icon window or by
+ *        original window
+ *
+ * @note Open addressing with linear probing; the capacity is always
+ *       a power of two and the table is never more than half full
+ */
+typedef struct {
+    icon_td **slots;        /**< Icons, or @c NULL for empty slots */
+    size_t capacity;        /**< Number of slots */
+    size_t count;           /**< Number of icons */
+    Bool by_orig;           /**< Hashed by original window */
+} table_td;
+
+
+/* Set when the daemon must stop */
+static volatile sig_atomic_t _quit = 0;
+
+
+/* Signal handler to stop the daemon */
+static void _quit_set(int signum)
+{
+    (void) signum;
+    _quit = 1;
+}
+
+
+/* Report X errors instead of exiting; a client may send a wrong or
+ * already destroyed window, and that must not kill every other icon */
+static int _error_handle(Display *display, XErrorEvent *error)
+{
+    char text[128];
+
+    XGetErrorText(display, error->error_code, text, sizeof(text));
+    fprintf(stderr, "X error: %s (request %d, resource 0x%lx)\n",
+            text, error->request_code, error->resourceid);
+
+    return 0;
+}
+
+
+/* Window an icon is hashed by */
+static inline Window _table_key(const table_td *table, const icon_td *icon)
+{
+    return (table->by_orig) ? icon->window_orig : icon->window;
+}
+
+
+/* Slot where a window is, or where it should be inserted */
+static size_t _table_slot(const table_td *table, Window window)
+{
+    size_t mask = table->capacity - 1;
+    size_t slot = (size_t) (window * 2654435761u) & mask;
+
+    while (table->slots[slot] &&
+            _table_key(table, table->slots[slot]) != window) {
+        slot = (slot + 1) & mask;
+    }
+
+    return slot;
+}
+
+
+/* Find the icon of a window */
+static icon_td *_table_find(const table_td *table, Window window)
+{
+    if (table->capacity == 0) {
+        return NULL;
+    }
+
+    return table->slots[_table_slot(table, window)];
+}
+
+
+/* Grow the table, if needed, so that more icons fit without growing */
+static int _table_reserve(table_td *table, size_t more)
+{
+    size_t capacity = table->capacity ? table->capacity : 64;
+
+    while (2 * (table->count + more) > capacity) {
+        capacity *= 2;
+    }
+    if (capacity == table->capacity) {
+        return 0;
+    }
+
+    table_td bigger;
+    bigger.capacity = capacity;
+    bigger.count = 0;
+    bigger.by_orig = table->by_orig;
+    bigger.slots = calloc(bigger.capacity, sizeof(*bigger.slots));
+    if (!bigger.slots) {
+        return -1;
+    }
+    for (size_t i = 0; i < table->capacity; ++i) {
+        if (table->slots[i]) {
+            bigger.slots[_table_slot(&bigger,
+                    _table_key(table, table->slots[i]))] = table->slots[i];
+            ++bigger.count;
+        }
+    }
+    free(table->slots);
+    *table = bigger;
+
+    return 0;
+}
+
+
+/* Add an icon, growing the table if needed */
+static int _table_insert(table_td *table, icon_td *icon)
+{
+    if (_table_reserve(table, 1) != 0) {
+        return -1;
+    }
+
+    table->slots[_table_slot(table, _table_key(table, icon))] = icon;
+    ++table->count;
+
+    return 0;
+}
+
+
+/* Remove an icon, shifting back the icons probed after it */
+static void _table_remove(table_td *table, const icon_td *icon)
+{
+    if (table->capacity == 0) {
+        return;
+    }
+
+    size_t mask = table->capacity - 1;
+    size_t hole = _table_slot(table, _table_key(table, icon));
+    size_t slot = hole;
+
+    if (!table->slots[hole]) {
+        return;
+    }
+    table->slots[hole] = NULL;
+    --table->count;
+
+    /* Keep the probing chains unbroken */
+    for (slot = (slot + 1) & mask; table->slots[slot];
+            slot = (slot + 1) & mask) {
+        size_t home = (size_t) (_table_key(table, table->slots[slot]) *
+                2654435761u) & mask;
+        if (((slot - home) & mask) >= ((slot - hole) & mask)) {
+            table->slots[hole] = table->slots[slot];
+            table->slots[slot] = NULL;
+            hole = slot;
+        }
+    }
+}
+
+
+/* Place an icon at the nearest free slot to its anchor, within the
+ * monitor of the anchor */
+static void _icon_place(place_td *place, const monitors_td *monitors,
+        icon_td *icon)
+{
+    compose_layout_td layout;
+
+    compose_layout(icon, &layout);
+    icon->place.width = layout.width;
+    icon->place.height = layout.height;
+    place_find(place, &icon->place, monitors_find(monitors,
+                icon->place.x_anchor, icon->place.y_anchor));
+    place_add(place, &icon->place);
+    icon->x_pos = icon->place.x;
+    icon->y_pos = icon->place.y;
+}
+
+
+/* Order icons by anchor, top to bottom and then left to right */
+static int _anchor_compare(const void *a, const void *b)
+{
+    const place_item_td *p = &(*(icon_td * const *) a)->place;
+    const place_item_td *q = &(*(icon_td * const *) b)->place;
+
+    if (p->y_anchor != q->y_anchor) {
+        return (p->y_anchor < q->y_anchor) ? -1 : 1;
+    }
+    return (p->x_anchor > q->x_anchor) - (p->x_anchor < q->x_anchor);
+}
+
+
+/* Place every icon again near its anchor, in the order of the anchors;
+ * icons being dragged stay where they are */
+static int _icons_repack(Display *display, place_td *place,
+        const monitors_td *monitors, const table_td *icons)
+{
+    icon_td **sorted = malloc((icons->count + 1) * sizeof(*sorted));
+    size_t count = 0;
+
+    if (!sorted) {
+        return -1;
+    }
+    for (size_t i = 0; i < icons->capacity; ++i) {
+        icon_td *icon = icons->slots[i];
+        if (icon && !icon->drag.active) {
+            place_remove(place, &icon->place);
+            sorted[count++] = icon;
+        }
+    }
+    qsort(sorted, count, sizeof(*sorted), _anchor_compare);
+
+    for (size_t i = 0; i < count; ++i) {
+        icon_td *icon = sorted[i];
+        int x = icon->x_pos;
+        int y = icon->y_pos;
+        _icon_place(place, monitors, icon);
+        if (icon->x_pos != x || icon->y_pos != y) {
+            XMoveWindow(display, icon->window, icon->x_pos, icon->y_pos);
+            state_save(icon);
+        }
+    }
+    free(sorted);
+
+    return 0;
+}
+
+
+/* Follow a change of the monitors: the grid is made for the new screen,
+ * icons still seen stay where they are, and every other one is placed
+ * again on the monitor nearest to its anchor */
+static void _icons_relayout(Display *display, place_td *place,
+        const monitors_td *monitors, const table_td *icons)
+{
+    place_td resized;
+
+    if (place_init(&resized, 0, 0, monitors->width, monitors->height,
+                place->gap) != 0) {
+        fprintf(stderr, "Cannot resize the icon placement grid\n");
+        return;
+    }
+    place_release(place);
+    *place = resized;
+
+    for (size_t i = 0; i < icons->capacity; ++i) {
+        icon_td *icon = icons->slots[i];
+        if (!icon) {
+            continue;
+        }
+        XRectangle area = { (short) icon->place.x, (short) icon->place.y,
+            (unsigned short) icon->place.width,
+            (unsigned short) icon->place.height };
+        if (monitors_visible(monitors, &area)) {
+            place_add(place, &icon->place);
+        }
+    }
+    for (size_t i = 0; i < icons->capacity; ++i) {
+        icon_td *icon = icons->slots[i];
+        if (icon && !icon->place.placed) {
+            _icon_place(place, monitors, icon);
+            XMoveWindow(display, icon->window, icon->x_pos, icon->y_pos);
+            state_save(icon);
+        }
+    }
+}
+
+
+/* Whether a window is of a class, by its class or by its name */
+static Bool _class_match(const char *res_class, const char *res_name,
+        const char *wanted)
+{
+    return ((res_class && strcmp(res_class, wanted) == 0) ||
+            (res_name && strcmp(res_name, wanted) == 0)) ? True : False;
+}
+
+
+/* Whether a window is among the first ones of a list */
+static Bool _window_listed(const Window *windows, unsigned int count,
+        Window window)
+{
+    for (unsigned int i = 0; i < count; ++i) {
+        if (windows[i] == window) {
+            return True;
+        }
+    }
+
+    return False;
+}
+
+
+/* Windows a request asks to iconify that have no icon yet: the ones
+ * given, and every client of the class, if any; all of them queried at
+ * once, and the information of the ones chosen kept in 'infos' */
+static unsigned int _windows_select(Display *display, const table_td *icons,
+        const table_td *origs, const request_td *request,
+        Window **windows, window_info_td **infos)
+{
+    Window *clients = NULL;
+    unsigned int client_count = 0;
+
+    if (request->res_class[0] != '\0') {
+        client_count = netwm_clients_get(display, &clients);
+    }
+
+    *windows = malloc((request->count + client_count + 1) *
+            sizeof(**windows));
+    *infos = malloc((request->count + client_count + 1) *
+            sizeof(**infos));
+    if (!*windows || !*infos) {
+        free(*windows);
+        free(*infos);
+        free(clients);
+        *windows = NULL;
+        *infos = NULL;
+        return 0;
+    }
+
+    /* The windows given, and then the other clients, as candidates */
+    unsigned int count = 0;
+    for (unsigned int i = 0; i < request->count; ++i) {
+        Window window = (Window) request->windows[i];
+        if (!_window_listed(*windows, count, window) &&
+                !_table_find(origs, window)) {
+            (*windows)[count++] = window;
+        }
+    }
+    unsigned int given = count;
+    for (unsigned int i = 0; i < client_count; ++i) {
+        if (!_window_listed(*windows, given, clients[i]) &&
+                !_table_find(origs, clients[i]) &&
+                !_table_find(icons, clients[i])) {
+            (*windows)[count++] = clients[i];
+        }
+    }
+    free(clients);
+
+    /* Every candidate queried in a single batch, with the icon of the
+     * windows given, unless it is given too; the other clients are only
+     * candidates, and their icons may be large, so the few that match
+     * read theirs when loaded */
+    Bool *published = malloc((count + 1) * sizeof(*published));
+    if (published) {
+        for (unsigned int i = 0; i < count; ++i) {
+            published[i] = (i < given &&
+                    strcmp(request->path, DEFAULT_ICON_PATH) == 0);
+        }
+    }
+    window_info_get_all(display, *windows, count, published, *infos);
+    free(published);
+
+    unsigned int chosen = 0;
+    for (unsigned int i = 0; i < count; ++i) {
+        window_info_td *info = &(*infos)[i];
+        if (i < given ||
+                _class_match(info->res_class, info->res_name,
+                    request->res_class)) {
+            (*windows)[chosen] = (*windows)[i];
+            (*infos)[chosen++] = *info;
+        } else {
+            window_info_free(info);
+        }
+    }
+
+    return chosen;
+}
+
+
+/* Make and load the icon of a window, as requested by a client */
+static icon_td *_request_icon(Display *display, const request_td *request,
+        Window window_orig, window_info_td *info)
+{
+    icon_td *icon = icon_init_info(display, window_orig, info,
+            (request->name[0] != '\0') ? request->name : NULL,
+            request->path, request->border,
+            request->width, request->height,
+            request->bg, request->fg, request->fc,
+            request->show_text ? True : False);
+    if (!icon) {
+        fprintf(stderr, "Window 0x%lx is not valid\n", window_orig);
+        return NULL;
+    }
+    icon->filter = (scale_filter_td) request->filter;
+    icon->snapshot = request->snapshot ? True : False;
+    icon->live_rate = request->live_rate;
+    if (request->anchor) {
+        icon->place.x_anchor = request->x_anchor;
+        icon->place.y_anchor = request->y_anchor;
+    }
+    if (request->group[0] != '\0') {
+        icon->group = strdup(request->group);
+    }
+
+    if (icon_load(icon) == None) {
+        fprintf(stderr, "Cannot load icon for 0x%lx\n", window_orig);
+        icon_destroy(icon);
+        return NULL;
+    }
+
+    return icon;
+}
+
+
+/* Create every icon of a batch, already loaded and placed, and iconify
+ * their windows, which only sends requests, with a single flush; the
+ * icons are added both by icon window and by original window, and kept
+ * in the state file.  Both tables are grown first, so that no window is
+ * iconified without an icon that can be found */
+static int _icons_create(Display *display, table_td *icons,
+        table_td *origs, place_td *place, icon_td **batch,
+        unsigned int count)
+{
+    if (_table_reserve(icons, count) != 0 ||
+            _table_reserve(origs, count) != 0) {
+        for (unsigned int i = 0; i < count; ++i) {
+            place_remove(place, &batch[i]->place);
+            state_forget(batch[i]->window_orig);
+            icon_destroy(batch[i]);
+        }
+        return -1;
+    }
+
+    for (unsigned int i = 0; i < count; ++i) {
+        icon_td *icon = batch[i];
+        icon_create(icon);
+        _table_insert(icons, icon);     /* Cannot fail: reserved */
+        _table_insert(origs, icon);
+        state_save(icon);
+    }
+    XFlush(display);
+
+    return 0;
+}
+
+
+/* Iconify the windows chosen by a client; every icon is loaded first,
+ * as loading may wait for the server, and then created at once */
+static int _request_iconify(Display *display, table_td *icons,
+        table_td *origs, place_td *place, const monitors_td *monitors,
+        const request_td *request)
+{
+    Window *windows;
+    window_info_td *infos;
+    unsigned int count = _windows_select(display, icons, origs, request,
+            &windows, &infos);
+    icon_td **batch = malloc((count + 1) * sizeof(*batch));
+    unsigned int loaded = 0;
+    int rc = (count > 0) ? 0 : -1;
+
+    for (unsigned int i = 0; i < count; ++i) {
+        icon_td *icon = NULL;
+        if (batch) {
+            icon = _request_icon(display, request, windows[i], &infos[i]);
+        } else {
+            window_info_free(&infos[i]);
+        }
+        if (icon) {
+            /* Away from the other icons, rather than on the window
+             * origin */
+            _icon_place(place, monitors, icon);
+            batch[loaded++] = icon;
+        } else {
+            rc = -1;
+        }
+    }
+    if (_icons_create(display, icons, origs, place, batch, loaded) != 0) {
+        rc = -1;
+    }
+
+    free(batch);
+    free(windows);
+    free(infos);
+
+    return rc;
+}
+
+
+/* Whether an icon is chosen by a request: of one of its windows, of its
+ * class, and of its group, whichever are given */
+static Bool _icon_chosen(const icon_td *icon, const request_td *request)
+{
+    if (request->count > 0) {
+        Bool given = False;
+        for (unsigned int i = 0; i < request->count && !given; ++i) {
+            given = (icon->window_orig == (Window) request->windows[i]);
+        }
+        if (!given) {
+            return False;
+        }
+    }
+    if (request->res_class[0] != '\0' && !_class_match(icon->res_class,
+                icon->res_name, request->res_class)) {
+        return False;
+    }
+    if (request->group[0] != '\0' &&
+            (!icon->group || strcmp(icon->group, request->group) != 0)) {
+        return False;
+    }
+
+    return True;
+}
+
+
+/* Restore the windows of the icons chosen by a client, all of them
+ * mapped again with a single flush */
+static int _request_restore(Display *display, table_td *icons,
+        table_td *origs, place_td *place, const request_td *request)
+{
+    if (request->count == 0 && request->res_class[0] == '\0' &&
+            request->group[0] == '\0') {
+        return -1;      /* Every icon, only if asked for by name */
+    }
+
+    icon_td **chosen = malloc((icons->count + 1) * sizeof(*chosen));
+    size_t count = 0;
+
+    if (!chosen) {
+        return -1;
+    }
+    for (size_t i = 0; i < icons->capacity; ++i) {
+        icon_td *icon = icons->slots[i];
+        if (icon && _icon_chosen(icon, request)) {
+            chosen[count++] = icon;
+        }
+    }
+
+    /* Icons are gone from the tables before their windows are mapped,
+     * so that the notifications of the maps find no icon */
+    for (size_t i = 0; i < count; ++i) {
+        icon_td *icon = chosen[i];
+        _table_remove(icons, icon);
+        _table_remove(origs, icon);
+        place_remove(place, &icon->place);
+        state_forget(icon->window_orig);
+        window_restore(icon);
+        icon_destroy(icon);
+    }
+    XFlush(display);
+    free(chosen);
+
+    return (count > 0) ? 0 : -1;
+}
+
+
+/* Make again the icons kept by a previous run, for the windows that
+ * still exist and are still of the same program: every window queried
+ * at once, every icon loaded from the source it was loaded from before,
+ * and placed where it was left, if still free */
+static void _icons_reattach(Display *display, table_td *icons,
+        table_td *origs, place_td *place, const monitors_td *monitors)
+{
+    state_record_td *records = malloc(STATE_SLOTS * sizeof(*records));
+    Window *windows = malloc(STATE_SLOTS * sizeof(*windows));
+    window_info_td *infos = malloc(STATE_SLOTS * sizeof(*infos));
+    icon_td **batch = malloc(STATE_SLOTS * sizeof(*batch));
+    unsigned int count = 0;
+    unsigned int loaded = 0;
+
+    if (!records || !windows || !infos || !batch) {
+        free(records);
+        free(windows);
+        free(infos);
+        free(batch);
+        return;
+    }
+    for (unsigned int i = 0; i < STATE_SLOTS; ++i) {
+        if (state_get(i, &records[count])) {
+            windows[count] = (Window) records[count].window;
+            ++count;
+        }
+    }
+    window_info_get_all(display, windows, count,
+            NULL/*icons: from their recorded source*/, infos);
+
+    for (unsigned int i = 0; i < count; ++i) {
+        const state_record_td *record = &records[i];
+        icon_td *icon = NULL;
+
+        if (infos[i].exists && state_class_key(infos[i].res_class,
+                    infos[i].res_name) == record->class_key) {
+            icon = icon_init_info(display, windows[i], &infos[i],
+                    record->name, record->path, record->border,
+                    record->width, record->height,
+                    record->bg, record->fg, record->fc,
+                    record->show_text ? True : False);
+        } else {
+            window_info_free(&infos[i]);
+        }
+        if (icon) {
+            icon->filter = (scale_filter_td) record->filter;
+            icon->snapshot = record->snapshot ? True : False;
+            icon->live_rate = record->live_rate;
+            if (record->live_rate > 0 && infos[i].x >= DisplayWidth(display,
+                        DefaultScreen(display))) {
+                /* Still out of sight, left by a crash: where it was */
+                icon->orig_x = record->orig_x;
+                icon->orig_y = record->orig_y;
+            }
+            if (record->group[0] != '\0') {
+                icon->group = strdup(record->group);
+            }
+            if (record->source <= ICON_SOURCE_DEFAULT) {
+                /* Loaded from there alone, while it is still there */
+                icon->source = (icon_source_td) record->source;
+                icon->source_key = record->source_key;
+            }
+            if (icon_load(icon) == None) {
+                icon_destroy(icon);
+                icon = NULL;
+            }
+        }
+        if (!icon) {
+            state_forget(windows[i]);
+            continue;
+        }
+
+        /* Where it was left, and anchored where it was before */
+        icon->place.x_anchor = record->x;
+        icon->place.y_anchor = record->y;
+        _icon_place(place, monitors, icon);
+        icon->place.x_anchor = record->x_anchor;
+        icon->place.y_anchor = record->y_anchor;
+        batch[loaded++] = icon;
+    }
+    _icons_create(display, icons, origs, place, batch, loaded);
+
+    free(records);
+    free(windows);
+    free(infos);
+    free(batch);
+}
+
+
+/* Read a whole request from a client */
+static int _request_read(int fd, request_td *request)
+{
+    char *buffer = (char *) request;
+    size_t done = 0;
+
+    while (done < sizeof(*request)) {
+        ssize_t n = read(fd, buffer + done, sizeof(*request) - done);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            return -1;
+        }
+        done += (size_t) n;
+    }
+
+    /* Never trust the strings to be terminated, nor the count */
+    request->name[sizeof(request->name) - 1] = '\0';
+    request->path[sizeof(request->path) - 1] = '\0';
+    request->res_class[sizeof(request->res_class) - 1] = '\0';
+    request->group[sizeof(request->group) - 1] = '\0';
+    if (request->count > REQUEST_WINDOWS_MAX) {
+        request->count = REQUEST_WINDOWS_MAX;
+    }
+
+    return 0;
+}
+
+
+/* Whether the other end of a socket is a process of this same user */
+static Bool _peer_trusted(int fd)
+{
+    struct ucred credentials;
+    socklen_t length = sizeof(credentials);
+
+    return getsockopt(fd, SOL_SOCKET, SO_PEERCRED, &credentials,
+            &length) == 0 && length == sizeof(credentials) &&
+        credentials.uid == getuid();
+}
+
+
+/* Accept a client, handle its request and answer with its status */
+static void _client_handle(Display *display, table_td *icons,
+        table_td *origs, place_td *place, const monitors_td *monitors,
+        int listen_fd)
+{
+    request_td request;
+    struct timeval timeout = { 1, 0 };  /* Do not hang on slow clients */
+    unsigned char status = 1;
+
+    int fd = accept(listen_fd, NULL, NULL);
+    if (fd < 0) {
+        return;
+    }
+    if (!_peer_trusted(fd)) {
+        fprintf(stderr, "Refused a client of another user\n");
+        close(fd);
+        return;
+    }
+    setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+    if (_request_read(fd, &request) == 0) {
+        switch (request.type) {
+            case REQUEST_ICONIFY:
+                status = (_request_iconify(display, icons, origs, place,
+                            monitors, &request) == 0) ? 0 : 1;
+                break;
+            case REQUEST_REPACK:
+                status = (_icons_repack(display, place, monitors,
+                            icons) == 0) ? 0 : 1;
+                break;
+            case REQUEST_RESTORE:
+                status = (_request_restore(display, icons, origs, place,
+                            &request) == 0) ? 0 : 1;
+                break;
+            default:
+                fprintf(stderr, "Unknown request %d\n", request.type);
+                break;
+        }
+    }
+
+    if (write(fd, &status, 1) != 1) {
+        fprintf(stderr, "Cannot answer client\n");
+    }
+    close(fd);
+}
+
+
+/* Fill a socket address */
+static int _address_set(struct sockaddr_un *address,
+        const char *socket_path)
+{
+    memset(address, 0, sizeof(*address));
+    address->sun_family = AF_UNIX;
+    if (strlen(socket_path) >= sizeof(address->sun_path)) {
+        return -1;
+    }
+    snprintf(address->sun_path, sizeof(address->sun_path), "%s",
+            socket_path);
+
+    return 0;
+}
+
+
+/* Bind a socket to its address, only open to this user, wherever it
+ * is (as '/tmp', without a runtime directory) */
+static int _socket_bind(int fd, const struct sockaddr_un *address)
+{
+    mode_t mask = umask(077);
+    int rc = bind(fd, (const struct sockaddr *) address, sizeof(*address));
+    umask(mask);
+
+    return rc;
+}
+
+
+/* Listen on the socket, replacing it if it is left by a dead daemon */
+static int _socket_listen(const char *socket_path)
+{
+    struct sockaddr_un address;
+
+    if (_address_set(&address, socket_path) != 0) {
+        return -1;
+    }
+
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0) {
+        return -1;
+    }
+
+    if (_socket_bind(fd, &address) != 0) {
+        int probe_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (probe_fd >= 0 && connect(probe_fd,
+                    (struct sockaddr *) &address, sizeof(address)) == 0) {
+            fprintf(stderr, "A daemon is already listening on '%s'\n",
+                    socket_path);
+            close(probe_fd);
+            close(fd);
+            return -1;
+        }
+        if (probe_fd >= 0) {
+            close(probe_fd);
+        }
+        unlink(socket_path);
+        if (_socket_bind(fd, &address) != 0) {
+            close(fd);
+            return -1;
+        }
+    }
+
+    if (listen(fd, 16) != 0) {
+        close(fd);
+        unlink(socket_path);
+        return -1;
+    }
+
+    return fd;
+}
+
+
+/* Get the path of the daemon socket for the current display */
+char *daemon_socket_path(char *buffer, size_t size)
+{
+    char display_name[64];
+    const char *runtime_dir = getenv("XDG_RUNTIME_DIR");
+    const char *display_env = getenv("DISPLAY");
+    int length;
+
+    /* Keep only the safe characters of the display name */
+    snprintf(display_name, sizeof(display_name), "%s",
+            (display_env) ? display_env : "");
+    for (char *c = display_name; *c; ++c) {
+        if (*c == '/' || *c == ':') {
+            *c = '_';
+        }
+    }
+
+    if (runtime_dir && runtime_dir[0] != '\0') {
+        length = snprintf(buffer, size, "%s/%s-%s.sock", runtime_dir,
+                DEFAULT_SOCKET_NAME, display_name);
+    } else {
+        length = snprintf(buffer, size, "/tmp/%s-%lu-%s.sock",
+                DEFAULT_SOCKET_NAME, (unsigned long) getuid(),
+                display_name);
+    }
+
+    return (length < 0 || (size_t) length >= size) ? NULL : buffer;
+}
+
+
+/* Send a request to a running daemon */
+int daemon_send(const char *socket_path, const request_td *request)
+{
+    struct sockaddr_un address;
+    unsigned char status = 1;
+
+    if (_address_set(&address, socket_path) != 0) {
+        return -1;
+    }
+
+    int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0) {
+        return -1;
+    }
+    if (connect(fd, (struct sockaddr *) &address, sizeof(address)) != 0 ||
+            !_peer_trusted(fd)) {
+        close(fd);
+        return -1;  /* A socket of another user is not our daemon */
+    }
+
+    if (write(fd, request, sizeof(*request)) != (ssize_t) sizeof(*request)
+            || read(fd, &status, 1) != 1) {
+        status = 1;
+    }
+    close(fd);
+
+    return (status == 0) ? 0 : 1;
+}
+
+
+/* Run the daemon until it is interrupted */
+int daemon_run(Display *display, const char *socket_path)
+{
+    table_td icons = { NULL, 0, 0, False };
+    table_td origs = { NULL, 0, 0, True };  /* Damage of live thumbnails */
+    monitors_td monitors;
+    place_td place;
+    struct sigaction action;
+    XEvent event;
+
+    /* Monitors are queried once here, and then only when they change */
+    monitors_init(&monitors, display);
+    if (place_init(&place, 0, 0, monitors.width, monitors.height,
+                DEFAULT_ICON_GAP) != 0) {
+        fprintf(stderr, "Cannot allocate the icon placement grid\n");
+        return -1;
+    }
+
+    int listen_fd = _socket_listen(socket_path);
+    if (listen_fd < 0) {
+        fprintf(stderr, "Cannot listen on '%s'\n", socket_path);
+        place_release(&place);
+        return -1;
+    }
+
+    /* Icons of the previous run, if any, back where they were */
+    XSetErrorHandler(_error_handle);
+    if (state_open() == 0) {
+        _icons_reattach(display, &icons, &origs, &place, &monitors);
+    } else {
+        fprintf(stderr, "Cannot map the state file: icons are not kept\n");
+    }
+
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = _quit_set;
+    sigaction(SIGINT, &action, NULL);
+    sigaction(SIGTERM, &action, NULL);
+    action.sa_handler = SIG_IGN;        /* Clients may go away early */
+    sigaction(SIGPIPE, &action, NULL);
+
+    struct pollfd fds[3];
+    fds[0].fd = ConnectionNumber(display);
+    fds[0].events = POLLIN;
+    fds[1].fd = listen_fd;
+    fds[1].events = POLLIN;
+    fds[2].fd = theme_watch();      /* Ignored by poll if negative */
+    fds[2].events = POLLIN;
+    fds[2].revents = 0;
+
+    while (!_quit) {
+        trace_dump_pending(stderr);
+
+        /* Dispatch every queued event to its icon */
+        while (XPending(display)) {
+            XNextEvent(display, &event);
+            if (monitors_event(&monitors, &event)) {
+                continue;
+            }
+            icon_td *icon = _table_find(&icons, event.xany.window);
+            if (!icon) {
+                icon = _table_find(&origs, event.xany.window);
+            }
+            if (icon && icon_event(icon, &event)) {
+                _table_remove(&icons, icon);
+                _table_remove(&origs, icon);
+                place_remove(&place, &icon->place);
+                state_forget(icon->window_orig);
+                icon_destroy(icon);
+            }
+        }
+
+        /* Follow the monitors, once the series of changes is over */
+        if (monitors_update(&monitors, display)) {
+            _icons_relayout(display, &place, &monitors, &icons);
+        }
+
+        /* Refresh the live thumbnails that are due, and wait no longer
+         * than the next one */
+        int timeout = -1;
+        for (size_t i = 0; i < icons.capacity; ++i) {
+            icon_td *icon = icons.slots[i];
+            if (!icon) {
+                continue;
+            }
+            icon_refresh(icon);
+            int due = icon_timeout(icon);
+            if (due >= 0 && (timeout < 0 || due < timeout)) {
+                timeout = due;
+            }
+
+            /* An icon dropped by the user is anchored where it was left */
+            if (!icon->drag.active && (icon->x_pos != icon->place.x ||
+                        icon->y_pos != icon->place.y)) {
+                place_move(&place, &icon->place, icon->x_pos, icon->y_pos);
+                state_save(icon);
+            }
+        }
+        XFlush(display);
+        if (XPending(display)) {
+            continue;
+        }
+
+        /* Wait for the server or for a client */
+        if (poll(fds, 3, timeout) < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            break;
+        }
+        if (fds[2].revents & POLLIN) {
+            theme_changed();
+        }
+        if (fds[1].revents & POLLIN) {
+            _client_handle(display, &icons, &origs, &place, &monitors,
+                    listen_fd);
+        }
+    }
+
+    /* Release every icon; the original windows stay iconified, but for
+     * those kept out of sight, which are put back, and their records are
+     * kept for the next run */
+    place_release(&place);
+    for (size_t i = 0; i < icons.capacity; ++i) {
+        icon_destroy(icons.slots[i]);
+    }
+    state_close();
+    free(icons.slots);
+    free(origs.slots);
+    theme_release();
+    close(listen_fd);
+    unlink(socket_path);
+    upload_stats_print(stderr);
+
+    return 0;
+}
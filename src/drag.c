@@ -0,0 +1,128 @@
+/**
+ * @file drag.c
+ *
+ * @brief Coalesced, frame-paced dragging implementation
+ */
+/*
+ * ISC License
+ * Copyright (c) 2025, J. A. Corbal <jacorbal@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS.  IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS
+ * ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF
+ * THIS SOFTWARE.
+ */
+
+/* Enable features from the POSIX.1-2008 standard */
+#define _POSIX_C_SOURCE 200809L
+
+/* Standard library includes */
+#include <time.h>       /* clock_gettime, timespec */
+
+/* X includes */
+#include <X11/Xlib.h>   /* Bool */
+
+/* Local includes */
+#include <drag.h>
+
+
+/* Initialize the state of a drag */
+void drag_init(drag_td *drag, unsigned int rate)
+{
+    drag->active = False;
+    drag->x_start = 0;
+    drag->y_start = 0;
+    drag->x = 0;
+    drag->y = 0;
+    drag->pending = False;
+    drag->interval = (rate > 0) ? 1000000 / (long long) rate : 0;
+    drag->last = 0;
+}
+
+
+/* Get the current monotonic time */
+long long drag_now(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (long long) now.tv_sec * 1000000 + now.tv_nsec / 1000;
+}
+
+
+/* Start a drag */
+void drag_start(drag_td *drag, int x_start, int y_start)
+{
+    drag->active = True;
+    drag->x_start = x_start;
+    drag->y_start = y_start;
+    drag->pending = False;
+}
+
+
+/* Take a pointer motion */
+Bool drag_motion(drag_td *drag, int x_root, int y_root)
+{
+    int x = x_root - drag->x_start;
+    int y = y_root - drag->y_start;
+
+    if (!drag->active || (x == drag->x && y == drag->y)) {
+        return False;
+    }
+    drag->x = x;
+    drag->y = y;
+    drag->pending = True;
+
+    return True;
+}
+
+
+/* Time until the window has to be moved */
+int drag_timeout(const drag_td *drag, long long now)
+{
+    if (!drag->pending) {
+        return -1;
+    }
+
+    /* Rounded up, so that the wait does not end just before the frame */
+    long long remaining = drag->last + drag->interval - now;
+    return (remaining > 0) ? (int) ((remaining + 999) / 1000) : 0;
+}
+
+
+/* Whether the window has to be moved now */
+Bool drag_step(drag_td *drag, long long now, int *x, int *y)
+{
+    if (drag_timeout(drag, now) != 0) {
+        return False;
+    }
+
+    *x = drag->x;
+    *y = drag->y;
+    drag->pending = False;
+    drag->last = now;
+
+    return True;
+}
+
+
+/* Stop a drag */
+Bool drag_stop(drag_td *drag, int *x, int *y)
+{
+    Bool pending = drag->pending;
+
+    *x = drag->x;
+    *y = drag->y;
+    drag->active = False;
+    drag->pending = False;
+
+    return pending;
+}
@@ -0,0 +1,883 @@
+/**
+ * @file font.c
+ *
+ * @brief Built-in bitmap font, for rendering without an X server
+ *        glyphs
+ *
+ * Rasterized from DejaVu Sans Mono at 10 px, antialiased, and centred in
+ * the cells; every pixel is its coverage, from 0 to 255.  DejaVu fonts
+ * are free (Bitstream Vera license).
+ */
+/*
+ * ISC License
+ * Copyright (c) 2025, J. A. Corbal <jacorbal@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS.  IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS
+ * ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF
+ * THIS SOFTWARE.
+ */
+
+/* Local includes */
+#include <font.h>
+
+
+/* Glyphs from ' ' to '~' */
+const unsigned char font_glyphs[FONT_LAST - FONT_FIRST + 1][FONT_HEIGHT]
+        [FONT_WIDTH] = {
+    {{0}}, /* space */
+    { /* ! */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0xfc,0x04,0x00,0x00},
+        {0x00,0x00,0xfc,0x04,0x00,0x00}, {0x00,0x00,0xfc,0x04,0x00,0x00},
+        {0x00,0x00,0xf5,0x01,0x00,0x00}, {0x00,0x00,0xd7,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0xfc,0x04,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* " */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0xd8,0x00,0xdc,0x00,0x00},
+        {0x00,0xd8,0x00,0xdc,0x00,0x00}, {0x00,0xd8,0x00,0xdc,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* # */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0xa2,0x26,0xa6,0x22},
+        {0x00,0x00,0xc8,0x00,0xc7,0x00}, {0x7c,0xff,0xff,0xff,0xff,0xf0},
+        {0x00,0x66,0x61,0x6c,0x5b,0x00}, {0xff,0xff,0xff,0xff,0xff,0x60},
+        {0x01,0xc5,0x02,0xc4,0x00,0x00}, {0x2c,0x98,0x33,0x94,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* $ */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x7c,0x00,0x00,0x00},
+        {0x32,0xd2,0xfd,0xff,0x58,0x00}, {0xa6,0x5f,0x7d,0x00,0x00,0x00},
+        {0x6a,0xb9,0xaf,0x24,0x00,0x00}, {0x00,0x2e,0xb4,0xb9,0x74,0x00},
+        {0x00,0x00,0x7e,0x53,0xc0,0x00}, {0xaf,0xef,0xf9,0xd5,0x3c,0x00},
+        {0x00,0x00,0x7c,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* % */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x60,0xf1,0xbc,0x07,0x00,0x00},
+        {0xc0,0x23,0x98,0x3a,0x00,0x05}, {0x63,0xf1,0xbd,0x22,0x84,0x53},
+        {0x00,0x10,0x7e,0x7d,0x0f,0x00}, {0x4a,0x8c,0x23,0xba,0xf1,0x60},
+        {0x03,0x00,0x38,0xa3,0x23,0xbc}, {0x00,0x00,0x08,0xbf,0xf2,0x64},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* & */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x0e,0xc1,0xfb,0xd4,0x00,0x00},
+        {0x38,0xb6,0x08,0x00,0x00,0x00}, {0x1a,0xea,0x49,0x00,0x00,0x00},
+        {0xba,0x28,0xc8,0x26,0x60,0x5f}, {0xc2,0x00,0x2a,0xcb,0x98,0x31},
+        {0xea,0x4a,0x09,0x99,0xd3,0x00}, {0x47,0xd9,0xef,0x93,0xbe,0x3f},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* ' */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0xd8,0x00,0x00,0x00},
+        {0x00,0x00,0xd8,0x00,0x00,0x00}, {0x00,0x00,0xd8,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* ( */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x17,0xb6,0x00,0x00,0x00}, {0x00,0x8d,0x4e,0x00,0x00,0x00},
+        {0x01,0xe0,0x05,0x00,0x00,0x00}, {0x24,0xcb,0x00,0x00,0x00,0x00},
+        {0x37,0xbc,0x00,0x00,0x00,0x00}, {0x24,0xcb,0x00,0x00,0x00,0x00},
+        {0x01,0xe0,0x05,0x00,0x00,0x00}, {0x00,0x8d,0x4e,0x00,0x00,0x00},
+        {0x00,0x18,0xb6,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* ) */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x0e,0xbe,0x02,0x00,0x00,0x00}, {0x00,0x8b,0x52,0x00,0x00,0x00},
+        {0x00,0x3b,0xaf,0x00,0x00,0x00}, {0x00,0x09,0xe7,0x00,0x00,0x00},
+        {0x00,0x00,0xf3,0x00,0x00,0x00}, {0x00,0x09,0xe7,0x00,0x00,0x00},
+        {0x00,0x3c,0xaf,0x00,0x00,0x00}, {0x00,0x8c,0x52,0x00,0x00,0x00},
+        {0x0e,0xbf,0x02,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* * */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x73,0x40,0x90,0x3c,0x76,0x00},
+        {0x06,0x8d,0xde,0x90,0x07,0x00}, {0x06,0x8c,0xde,0x90,0x07,0x00},
+        {0x73,0x40,0x90,0x3c,0x76,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* + */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0xd4,0x00,0x00,0x00}, {0x00,0x00,0xd4,0x00,0x00,0x00},
+        {0xff,0xff,0xff,0xff,0xff,0x28}, {0x00,0x00,0xd4,0x00,0x00,0x00},
+        {0x00,0x00,0xd4,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* , */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0xdc,0x60,0x00,0x00},
+        {0x00,0x04,0xf1,0x28,0x00,0x00}, {0x00,0x38,0xa7,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* - */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0xc4,0xff,0xc8,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* . */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x1c,0xff,0x20,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* / */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x46,0xa6,0x00},
+        {0x00,0x00,0x00,0xc0,0x2d,0x00}, {0x00,0x00,0x3b,0xb0,0x00,0x00},
+        {0x00,0x00,0xb7,0x37,0x00,0x00}, {0x00,0x32,0xbb,0x00,0x00,0x00},
+        {0x00,0xad,0x41,0x00,0x00,0x00}, {0x29,0xc5,0x00,0x00,0x00,0x00},
+        {0xa3,0x4d,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* 0 */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x0e,0xb2,0xf1,0xb4,0x10,0x00},
+        {0x80,0xa0,0x10,0xa0,0x85,0x00}, {0xbf,0x3b,0x00,0x39,0xc6,0x00},
+        {0xd2,0x32,0xd4,0x2f,0xd9,0x00}, {0xbf,0x3b,0x00,0x39,0xc6,0x00},
+        {0x80,0x9f,0x0f,0x9e,0x86,0x00}, {0x0f,0xb4,0xf2,0xb6,0x11,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* 1 */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0xac,0xff,0xf4,0x00,0x00,0x00},
+        {0x00,0x04,0xf4,0x00,0x00,0x00}, {0x00,0x04,0xf4,0x00,0x00,0x00},
+        {0x00,0x04,0xf4,0x00,0x00,0x00}, {0x00,0x04,0xf4,0x00,0x00,0x00},
+        {0x00,0x04,0xf4,0x00,0x00,0x00}, {0x90,0xff,0xff,0xff,0x78,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* 2 */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x0e,0xa2,0xf1,0xd4,0x40,0x00},
+        {0x55,0x62,0x0e,0x61,0xd9,0x00}, {0x00,0x00,0x00,0x2f,0xc3,0x00},
+        {0x00,0x00,0x0a,0xb8,0x32,0x00}, {0x00,0x0e,0xb4,0x3c,0x00,0x00},
+        {0x16,0xbe,0x39,0x00,0x00,0x00}, {0x70,0xff,0xff,0xff,0xfc,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* 3 */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x10,0xa1,0xf2,0xc8,0x28,0x00},
+        {0x5a,0x56,0x0c,0x72,0xaf,0x00}, {0x00,0x00,0x05,0x73,0xa4,0x00},
+        {0x00,0x64,0xff,0xe5,0x23,0x00}, {0x00,0x00,0x05,0x53,0xc7,0x00},
+        {0x7b,0x3c,0x08,0x52,0xde,0x00}, {0x27,0xbf,0xf5,0xd3,0x44,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* 4 */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x69,0xfb,0x14,0x00},
+        {0x00,0x28,0x85,0xe8,0x14,0x00}, {0x06,0xa1,0x07,0xe8,0x14,0x00},
+        {0x82,0x2d,0x00,0xe8,0x14,0x00}, {0xfd,0xff,0xff,0xff,0xff,0x0c},
+        {0x00,0x00,0x00,0xe8,0x14,0x00}, {0x00,0x00,0x00,0xe8,0x14,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* 5 */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x6c,0xff,0xff,0xff,0x44,0x00},
+        {0x6c,0x78,0x00,0x00,0x00,0x00}, {0x6c,0xf2,0xf4,0xb2,0x12,0x00},
+        {0x00,0x00,0x11,0xa3,0x91,0x00}, {0x00,0x00,0x00,0x3f,0xbd,0x00},
+        {0x00,0x00,0x10,0xa1,0x8e,0x00}, {0xbc,0xff,0xf3,0xab,0x10,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* 6 */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x0d,0xa4,0xf0,0xff,0x38,0x00},
+        {0x8d,0xb5,0x15,0x00,0x00,0x00}, {0xdb,0x2a,0x00,0x00,0x00,0x00},
+        {0xed,0x89,0xf6,0xcd,0x2a,0x00}, {0xde,0x5e,0x07,0x74,0xa8,0x00},
+        {0xa4,0x5f,0x07,0x74,0xa7,0x00}, {0x1f,0xc3,0xf6,0xcd,0x29,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* 7 */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0xc4,0xff,0xff,0xff,0xc1,0x00},
+        {0x00,0x00,0x00,0x7b,0x64,0x00}, {0x00,0x00,0x04,0xd6,0x0c,0x00},
+        {0x00,0x00,0x54,0x9a,0x00,0x00}, {0x00,0x00,0xc1,0x34,0x00,0x00},
+        {0x00,0x2d,0xcf,0x00,0x00,0x00}, {0x00,0x9a,0x6a,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* 8 */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x26,0xca,0xf7,0xcb,0x27,0x00},
+        {0x9d,0x85,0x08,0x7e,0xa1,0x00}, {0x82,0x83,0x07,0x7b,0x86,0x00},
+        {0x14,0xd7,0xff,0xda,0x17,0x00}, {0xb1,0x62,0x07,0x61,0xb4,0x00},
+        {0xc8,0x63,0x06,0x5d,0xcc,0x00}, {0x3e,0xd4,0xf8,0xd4,0x3e,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* 9 */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x28,0xca,0xf5,0xc3,0x1f,0x00},
+        {0xa8,0x73,0x07,0x5f,0xa4,0x00}, {0xa8,0x72,0x06,0x5e,0xdd,0x00},
+        {0x2b,0xcf,0xf6,0x85,0xef,0x00}, {0x00,0x00,0x00,0x2f,0xd9,0x00},
+        {0x00,0x00,0x16,0xb7,0x8b,0x00}, {0x38,0xff,0xf0,0xa5,0x0d,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* : */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x1c,0xff,0x20,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x1c,0xff,0x20,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* ; */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0xfc,0x40,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0xec,0x50,0x00,0x00},
+        {0x00,0x0d,0xf5,0x1d,0x00,0x00}, {0x00,0x48,0x97,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* < */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x05,0x54,0xbb,0x24}, {0x21,0x86,0xd0,0x8b,0x28,0x00},
+        {0xfc,0x9d,0x08,0x00,0x00,0x00}, {0x21,0x87,0xd0,0x8a,0x28,0x00},
+        {0x00,0x00,0x05,0x55,0xbc,0x24}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* = */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0xff,0xff,0xff,0xff,0xff,0x28},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0xff,0xff,0xff,0xff,0xff,0x28},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* > */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0xc9,0x64,0x0b,0x00,0x00,0x00}, {0x1c,0x7c,0xcf,0x96,0x2f,0x00},
+        {0x00,0x00,0x02,0x82,0xfd,0x24}, {0x1c,0x7b,0xcf,0x97,0x30,0x00},
+        {0xc9,0x65,0x0c,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* ? */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0xff,0xff,0xe8,0x62,0x00,0x00},
+        {0x00,0x02,0x4e,0xd2,0x00,0x00}, {0x00,0x0f,0xc5,0x56,0x00,0x00},
+        {0x00,0x9b,0x6b,0x00,0x00,0x00}, {0x00,0xc6,0x28,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0xd0,0x30,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* @ */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x6d,0xe2,0xf1,0x96,0x01},
+        {0x54,0xc2,0x2a,0x0e,0xa0,0x4e}, {0xc4,0x15,0x76,0xed,0xaf,0x7b},
+        {0xb7,0x14,0xc8,0x12,0x85,0x80}, {0xa4,0x34,0x8c,0x00,0x38,0x80},
+        {0xbe,0x14,0xc8,0x12,0x85,0x80}, {0xc5,0x22,0x76,0xee,0xa9,0x80},
+        {0x4b,0xd4,0x3e,0x07,0x00,0x00}, {0x00,0x50,0xd0,0xf9,0xa3,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* A */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x31,0xfa,0x54,0x00,0x00},
+        {0x00,0x82,0x85,0xa6,0x00,0x00}, {0x00,0xca,0x0c,0xcf,0x06,0x00},
+        {0x24,0xb0,0x00,0x8d,0x49,0x00}, {0x75,0xff,0xff,0xff,0x9b,0x00},
+        {0xc6,0x29,0x00,0x0c,0xe4,0x02}, {0xe3,0x00,0x00,0x00,0xc2,0x3f},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* B */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0xc0,0xff,0xfa,0xca,0x29,0x00},
+        {0xc0,0x3c,0x04,0x77,0xa7,0x00}, {0xc0,0x3c,0x04,0x7f,0x9b,0x00},
+        {0xc0,0xff,0xff,0xe9,0x2b,0x00}, {0xc0,0x3c,0x04,0x48,0xcf,0x00},
+        {0xc0,0x3c,0x03,0x3f,0xe9,0x00}, {0xc0,0xff,0xfb,0xda,0x54,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* C */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x0a,0x98,0xea,0xcf,0x24,0x00},
+        {0x8b,0xab,0x15,0x2b,0x68,0x00}, {0xe2,0x26,0x00,0x00,0x00,0x00},
+        {0xfb,0x0a,0x00,0x00,0x00,0x00}, {0xe3,0x26,0x00,0x00,0x00,0x00},
+        {0x8f,0xab,0x15,0x2f,0x67,0x00}, {0x0c,0x9c,0xeb,0xd0,0x24,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* D */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0xd4,0xfd,0xdf,0x87,0x06,0x00},
+        {0xd4,0x2a,0x23,0xbf,0x75,0x00}, {0xd4,0x28,0x00,0x43,0xc6,0x00},
+        {0xd4,0x28,0x00,0x2b,0xdf,0x00}, {0xd4,0x28,0x00,0x43,0xc7,0x00},
+        {0xd4,0x2a,0x21,0xbd,0x77,0x00}, {0xd4,0xfd,0xe1,0x89,0x07,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* E */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0xd8,0xff,0xff,0xff,0x78,0x00},
+        {0xd8,0x24,0x00,0x00,0x00,0x00}, {0xd8,0x24,0x00,0x00,0x00,0x00},
+        {0xd8,0xff,0xff,0xff,0x54,0x00}, {0xd8,0x24,0x00,0x00,0x00,0x00},
+        {0xd8,0x24,0x00,0x00,0x00,0x00}, {0xd8,0xff,0xff,0xff,0x90,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* F */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0xdc,0xff,0xff,0xff,0x70,0x00},
+        {0xdc,0x20,0x00,0x00,0x00,0x00}, {0xdc,0x20,0x00,0x00,0x00,0x00},
+        {0xdc,0xff,0xff,0xff,0x20,0x00}, {0xdc,0x20,0x00,0x00,0x00,0x00},
+        {0xdc,0x20,0x00,0x00,0x00,0x00}, {0xdc,0x20,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* G */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x09,0x96,0xea,0xd5,0x30,0x00},
+        {0x87,0xaf,0x16,0x29,0x6c,0x00}, {0xde,0x2a,0x00,0x00,0x00,0x00},
+        {0xf8,0x0e,0x1c,0xff,0xe4,0x00}, {0xdf,0x29,0x00,0x0c,0xe4,0x00},
+        {0x89,0xac,0x14,0x24,0xe4,0x00}, {0x0a,0x99,0xeb,0xe0,0x60,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* H */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0xd4,0x28,0x00,0x24,0xdc,0x00},
+        {0xd4,0x28,0x00,0x24,0xdc,0x00}, {0xd4,0x28,0x00,0x24,0xdc,0x00},
+        {0xd4,0xff,0xff,0xff,0xdc,0x00}, {0xd4,0x28,0x00,0x24,0xdc,0x00},
+        {0xd4,0x28,0x00,0x24,0xdc,0x00}, {0xd4,0x28,0x00,0x24,0xdc,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* I */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x84,0xff,0xff,0xff,0x88,0x00},
+        {0x00,0x00,0xfc,0x00,0x00,0x00}, {0x00,0x00,0xfc,0x00,0x00,0x00},
+        {0x00,0x00,0xfc,0x00,0x00,0x00}, {0x00,0x00,0xfc,0x00,0x00,0x00},
+        {0x00,0x00,0xfc,0x00,0x00,0x00}, {0x84,0xff,0xff,0xff,0x88,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* J */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0xbc,0xff,0xff,0x1c,0x00},
+        {0x00,0x00,0x00,0xe0,0x1c,0x00}, {0x00,0x00,0x00,0xe0,0x1c,0x00},
+        {0x00,0x00,0x00,0xe0,0x1c,0x00}, {0x00,0x00,0x00,0xe5,0x15,0x00},
+        {0x90,0x18,0x32,0xee,0x01,0x00}, {0x72,0xe7,0xe8,0x62,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* K */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0xf4,0x08,0x00,0x61,0xbc,0x0a},
+        {0xf4,0x08,0x60,0xbd,0x0a,0x00}, {0xf4,0x67,0xc2,0x0a,0x00,0x00},
+        {0xf4,0xcb,0xd5,0x0a,0x00,0x00}, {0xf4,0x10,0x89,0x98,0x00,0x00},
+        {0xf4,0x08,0x07,0xd2,0x4d,0x00}, {0xf4,0x08,0x00,0x31,0xe4,0x17},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* L */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0xf4,0x0c,0x00,0x00,0x00,0x00},
+        {0xf4,0x0c,0x00,0x00,0x00,0x00}, {0xf4,0x0c,0x00,0x00,0x00,0x00},
+        {0xf4,0x0c,0x00,0x00,0x00,0x00}, {0xf4,0x0c,0x00,0x00,0x00,0x00},
+        {0xf4,0x0c,0x00,0x00,0x00,0x00}, {0xf4,0xff,0xff,0xff,0x90,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* M */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0xfc,0x7e,0x00,0x60,0xfb,0x28},
+        {0xe4,0xb0,0x03,0xae,0xc8,0x28}, {0xe4,0x68,0x78,0x87,0xc4,0x28},
+        {0xe4,0x0e,0xf0,0x23,0xc4,0x28}, {0xe4,0x00,0x00,0x00,0xc4,0x28},
+        {0xe4,0x00,0x00,0x00,0xc4,0x28}, {0xe4,0x00,0x00,0x00,0xc4,0x28},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* N */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0xd4,0xa2,0x00,0x1c,0xd8,0x00},
+        {0xd4,0xd9,0x17,0x1c,0xd8,0x00}, {0xd4,0x76,0x7d,0x1c,0xd8,0x00},
+        {0xd4,0x24,0xc9,0x21,0xd8,0x00}, {0xd4,0x20,0x7a,0x75,0xd8,0x00},
+        {0xd4,0x20,0x14,0xd7,0xd8,0x00}, {0xd4,0x20,0x00,0x9f,0xd8,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* O */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x17,0xba,0xf2,0xbd,0x18,0x00},
+        {0x95,0x95,0x0e,0x8e,0x9b,0x00}, {0xd3,0x31,0x00,0x2a,0xda,0x00},
+        {0xe6,0x20,0x00,0x19,0xed,0x00}, {0xd4,0x31,0x00,0x2a,0xda,0x00},
+        {0x97,0x94,0x0e,0x8e,0x9b,0x00}, {0x18,0xbc,0xf3,0xbf,0x1a,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* P */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0xd8,0xff,0xf7,0xc5,0x27,0x00},
+        {0xd8,0x24,0x07,0x88,0xaa,0x00}, {0xd8,0x24,0x07,0x88,0xab,0x00},
+        {0xd8,0xff,0xf8,0xc9,0x2a,0x00}, {0xd8,0x24,0x00,0x00,0x00,0x00},
+        {0xd8,0x24,0x00,0x00,0x00,0x00}, {0xd8,0x24,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* Q */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x17,0xba,0xf2,0xbf,0x1a,0x00},
+        {0x95,0x95,0x0e,0x8e,0x9d,0x00}, {0xd3,0x31,0x00,0x2a,0xdb,0x00},
+        {0xe6,0x20,0x00,0x19,0xee,0x00}, {0xd4,0x31,0x00,0x2a,0xdd,0x00},
+        {0x96,0x94,0x0e,0x8e,0x99,0x00}, {0x18,0xbd,0xf9,0xe0,0x15,0x00},
+        {0x00,0x00,0x0a,0xae,0x3f,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* R */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0xac,0xff,0xf9,0xcd,0x33,0x00},
+        {0xac,0x50,0x05,0x77,0xbd,0x00}, {0xac,0x50,0x04,0x71,0xb0,0x00},
+        {0xac,0xff,0xff,0xce,0x15,0x00}, {0xac,0x50,0x14,0xb9,0x58,0x00},
+        {0xac,0x50,0x00,0x26,0xd9,0x04}, {0xac,0x50,0x00,0x00,0xa6,0x62},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* S */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x2a,0xc7,0xf3,0xaa,0x12,0x00},
+        {0xb9,0x71,0x0b,0x4d,0x5b,0x00}, {0xb2,0x4c,0x00,0x00,0x00,0x00},
+        {0x16,0x8b,0xa6,0x92,0x18,0x00}, {0x00,0x00,0x00,0x3e,0xb6,0x00},
+        {0x83,0x36,0x09,0x66,0xc6,0x00}, {0x32,0xc6,0xf6,0xcf,0x39,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* T */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0xff,0xff,0xff,0xff,0xff,0x6c},
+        {0x00,0x00,0xdc,0x24,0x00,0x00}, {0x00,0x00,0xdc,0x24,0x00,0x00},
+        {0x00,0x00,0xdc,0x24,0x00,0x00}, {0x00,0x00,0xdc,0x24,0x00,0x00},
+        {0x00,0x00,0xdc,0x24,0x00,0x00}, {0x00,0x00,0xdc,0x24,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* U */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0xc8,0x34,0x00,0x30,0xcc,0x00},
+        {0xc8,0x34,0x00,0x30,0xcc,0x00}, {0xc8,0x34,0x00,0x30,0xcc,0x00},
+        {0xc8,0x34,0x00,0x30,0xcc,0x00}, {0xc4,0x34,0x00,0x30,0xc7,0x00},
+        {0xa3,0x78,0x0b,0x75,0xa7,0x00}, {0x21,0xc6,0xf6,0xc7,0x23,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* V */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0xed,0x08,0x00,0x00,0xdc,0x28},
+        {0xb4,0x45,0x00,0x21,0xda,0x00}, {0x66,0x8c,0x00,0x68,0x8c,0x00},
+        {0x19,0xd2,0x00,0xae,0x3d,0x00}, {0x00,0xca,0x1f,0xdc,0x03,0x00},
+        {0x00,0x7d,0x9c,0xa1,0x00,0x00}, {0x00,0x2f,0xfd,0x53,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* W */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0xeb,0x08,0x00,0x00,0x03,0xeb},
+        {0xc5,0x25,0x00,0x00,0x1f,0xc8}, {0x9d,0x44,0xa1,0xa0,0x3f,0xa1},
+        {0x75,0x63,0xb9,0xb3,0x5e,0x79}, {0x4d,0x96,0x9f,0x99,0x93,0x52},
+        {0x25,0xea,0x61,0x5d,0xe9,0x2a}, {0x03,0xf8,0x23,0x1f,0xfc,0x06},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* X */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0xc1,0x48,0x00,0x23,0xd9,0x0d},
+        {0x26,0xd3,0x07,0xb7,0x47,0x00}, {0x00,0x7b,0xc0,0x9e,0x00,0x00},
+        {0x00,0x29,0xff,0x47,0x00,0x00}, {0x01,0xc0,0x65,0xcc,0x05,0x00},
+        {0x6b,0x9c,0x00,0x85,0x7a,0x00}, {0xdb,0x11,0x00,0x0a,0xd9,0x24},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* Y */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0xdc,0x1e,0x00,0x0b,0xdd,0x22},
+        {0x59,0xa8,0x00,0x84,0x7e,0x00}, {0x00,0xbd,0x5b,0xd2,0x07,0x00},
+        {0x00,0x29,0xfa,0x49,0x00,0x00}, {0x00,0x00,0xec,0x10,0x00,0x00},
+        {0x00,0x00,0xec,0x10,0x00,0x00}, {0x00,0x00,0xec,0x10,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* Z */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0xd0,0xff,0xff,0xff,0xdf,0x00},
+        {0x00,0x00,0x00,0x91,0x55,0x00}, {0x00,0x00,0x45,0x9c,0x00,0x00},
+        {0x00,0x12,0xbf,0x0b,0x00,0x00}, {0x00,0xa4,0x34,0x00,0x00,0x00},
+        {0x5d,0x77,0x00,0x00,0x00,0x00}, {0xe4,0xff,0xff,0xff,0xff,0x04},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* [ */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0xfc,0xff,0x14,0x00,0x00}, {0x00,0xe4,0x00,0x00,0x00,0x00},
+        {0x00,0xe4,0x00,0x00,0x00,0x00}, {0x00,0xe4,0x00,0x00,0x00,0x00},
+        {0x00,0xe4,0x00,0x00,0x00,0x00}, {0x00,0xe4,0x00,0x00,0x00,0x00},
+        {0x00,0xe4,0x00,0x00,0x00,0x00}, {0x00,0xe4,0x00,0x00,0x00,0x00},
+        {0x00,0xfc,0xff,0x14,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* \ */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0xa3,0x4c,0x00,0x00,0x00,0x00},
+        {0x2a,0xc5,0x00,0x00,0x00,0x00}, {0x00,0xad,0x41,0x00,0x00,0x00},
+        {0x00,0x32,0xbb,0x00,0x00,0x00}, {0x00,0x00,0xb7,0x37,0x00,0x00},
+        {0x00,0x00,0x3c,0xb0,0x00,0x00}, {0x00,0x00,0x00,0xc0,0x2d,0x00},
+        {0x00,0x00,0x00,0x46,0xa6,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* ] */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x10,0xff,0xff,0x04,0x00,0x00}, {0x00,0x00,0xe4,0x04,0x00,0x00},
+        {0x00,0x00,0xe4,0x04,0x00,0x00}, {0x00,0x00,0xe4,0x04,0x00,0x00},
+        {0x00,0x00,0xe4,0x04,0x00,0x00}, {0x00,0x00,0xe4,0x04,0x00,0x00},
+        {0x00,0x00,0xe4,0x04,0x00,0x00}, {0x00,0x00,0xe4,0x04,0x00,0x00},
+        {0x10,0xff,0xff,0x04,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* ^ */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x4b,0xfb,0x52,0x00,0x00},
+        {0x1b,0xd0,0x30,0xcf,0x20,0x00}, {0xb7,0x31,0x00,0x2d,0xba,0x05},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* _ */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0xff,0xff,0xff,0xff,0xff,0xff},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* ` */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x06,0xbd,0x25,0x00,0x00,0x00}, {0x00,0x1a,0xaf,0x03,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* a */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x64,0xff,0xf9,0xc5,0x25,0x00},
+        {0x00,0x00,0x03,0x5d,0xa4,0x00}, {0x45,0xd6,0xfb,0xff,0xbb,0x00},
+        {0xb9,0x60,0x0b,0x6f,0xbc,0x00}, {0x56,0xe9,0xed,0x87,0xbc,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* b */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0xd0,0x18,0x00,0x00,0x00,0x00}, {0xd0,0x18,0x00,0x00,0x00,0x00},
+        {0xd0,0x18,0x00,0x00,0x00,0x00}, {0xd0,0x8b,0xf4,0xbb,0x11,0x00},
+        {0xd0,0x71,0x0b,0x97,0x81,0x00}, {0xd0,0x20,0x00,0x4c,0xa6,0x00},
+        {0xd0,0x6f,0x0a,0x97,0x80,0x00}, {0xd0,0x8d,0xf5,0xbb,0x11,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* c */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x2d,0xc4,0xf7,0xff,0x30,0x00},
+        {0xd2,0x5f,0x07,0x00,0x00,0x00}, {0xf0,0x00,0x00,0x00,0x00,0x00},
+        {0xd3,0x5f,0x06,0x00,0x00,0x00}, {0x2f,0xc5,0xf8,0xff,0x30,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* d */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x20,0xc8,0x00}, {0x00,0x00,0x00,0x20,0xc8,0x00},
+        {0x00,0x00,0x00,0x20,0xc8,0x00}, {0x16,0xc0,0xf4,0x8d,0xc8,0x00},
+        {0x8b,0x90,0x0a,0x7a,0xc8,0x00}, {0xaf,0x43,0x00,0x28,0xc8,0x00},
+        {0x8a,0x90,0x0a,0x79,0xc8,0x00}, {0x16,0xc0,0xf5,0x8e,0xc8,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* e */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x23,0xbf,0xf4,0xcc,0x28,0x00},
+        {0xbd,0x5e,0x07,0x4e,0xb4,0x00}, {0xed,0xff,0xff,0xff,0xdd,0x00},
+        {0xbe,0x4a,0x06,0x00,0x00,0x00}, {0x24,0xbd,0xf5,0xff,0xa8,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* f */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x3e,0xe8,0xff,0x00,0x00}, {0x00,0xac,0x4c,0x00,0x00,0x00},
+        {0x00,0xc5,0x20,0x00,0x00,0x00}, {0xff,0xff,0xff,0xff,0x00,0x00},
+        {0x00,0xc8,0x20,0x00,0x00,0x00}, {0x00,0xc8,0x20,0x00,0x00,0x00},
+        {0x00,0xc8,0x20,0x00,0x00,0x00}, {0x00,0xc8,0x20,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* g */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x15,0xbf,0xf4,0x92,0xc8,0x00},
+        {0x89,0x95,0x0b,0x77,0xc8,0x00}, {0xaf,0x44,0x00,0x28,0xc8,0x00},
+        {0x8a,0x93,0x0a,0x75,0xc8,0x00}, {0x16,0xc1,0xf5,0x95,0xc3,0x00},
+        {0x00,0x00,0x04,0x6c,0x9b,0x00}, {0x18,0xff,0xfb,0xc5,0x1f,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* h */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0xac,0x38,0x00,0x00,0x00,0x00}, {0xac,0x38,0x00,0x00,0x00,0x00},
+        {0xac,0x38,0x00,0x00,0x00,0x00}, {0xac,0x8c,0xee,0xd1,0x15,0x00},
+        {0xac,0x8d,0x0a,0x9b,0x69,0x00}, {0xac,0x3b,0x00,0x64,0x7f,0x00},
+        {0xac,0x38,0x00,0x64,0x80,0x00}, {0xac,0x38,0x00,0x64,0x80,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* i */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0xe4,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x50,0xff,0xfc,0x00,0x00,0x00},
+        {0x00,0x00,0xe4,0x00,0x00,0x00}, {0x00,0x00,0xe4,0x00,0x00,0x00},
+        {0x00,0x00,0xe4,0x00,0x00,0x00}, {0xb0,0xff,0xff,0xff,0xc4,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* j */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0xe4,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x90,0xff,0xe4,0x00,0x00},
+        {0x00,0x00,0x00,0xe4,0x00,0x00}, {0x00,0x00,0x00,0xe4,0x00,0x00},
+        {0x00,0x00,0x00,0xe4,0x00,0x00}, {0x00,0x00,0x00,0xe4,0x00,0x00},
+        {0x00,0x00,0x3a,0xd1,0x00,0x00}, {0x08,0xff,0xf1,0x5a,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* k */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0xd8,0x14,0x00,0x00,0x00,0x00}, {0xd8,0x14,0x00,0x00,0x00,0x00},
+        {0xd8,0x14,0x00,0x00,0x00,0x00}, {0xd8,0x14,0x36,0xc1,0x1f,0x00},
+        {0xd8,0x62,0xb9,0x11,0x00,0x00}, {0xd8,0xb2,0xca,0x0b,0x00,0x00},
+        {0xd8,0x14,0x67,0xaa,0x00,0x00}, {0xd8,0x14,0x00,0x9d,0x79,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* l */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x68,0xff,0xf0,0x00,0x00,0x00}, {0x00,0x00,0xe8,0x00,0x00,0x00},
+        {0x00,0x00,0xe8,0x00,0x00,0x00}, {0x00,0x00,0xe8,0x00,0x00,0x00},
+        {0x00,0x00,0xe8,0x00,0x00,0x00}, {0x00,0x00,0xe8,0x00,0x00,0x00},
+        {0x00,0x00,0xde,0x23,0x00,0x00}, {0x00,0x00,0x64,0xf3,0xdc,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* m */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0xde,0xd9,0x93,0xd7,0xa7,0x00},
+        {0xe5,0x1f,0xef,0x1c,0xdc,0x00}, {0xd1,0x00,0xd2,0x00,0xc9,0x0a},
+        {0xd0,0x00,0xd0,0x00,0xc8,0x0c}, {0xd0,0x00,0xd0,0x00,0xc8,0x0c},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* n */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x8c,0x94,0xe6,0xde,0x27,0x00},
+        {0x8c,0xa9,0x0c,0x7d,0x89,0x00}, {0x8c,0x5b,0x00,0x44,0x9f,0x00},
+        {0x8c,0x58,0x00,0x44,0xa0,0x00}, {0x8c,0x58,0x00,0x44,0xa0,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* o */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x23,0xc6,0xf5,0xc8,0x25,0x00},
+        {0xa7,0x7a,0x0a,0x75,0xad,0x00}, {0xcb,0x28,0x00,0x21,0xd2,0x00},
+        {0xa7,0x7a,0x09,0x75,0xad,0x00}, {0x23,0xc6,0xf6,0xc9,0x25,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* p */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0xc4,0x8e,0xf4,0xc0,0x16,0x00},
+        {0xc4,0x7c,0x0b,0x8c,0x8a,0x00}, {0xc4,0x2c,0x00,0x40,0xaf,0x00},
+        {0xc4,0x7a,0x0a,0x8c,0x8b,0x00}, {0xc4,0x8e,0xf4,0xc2,0x18,0x00},
+        {0xc4,0x24,0x00,0x00,0x00,0x00}, {0xc4,0x24,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* q */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x15,0xbe,0xf4,0x8d,0xc8,0x00},
+        {0x86,0x93,0x0b,0x7a,0xc8,0x00}, {0xab,0x47,0x00,0x28,0xc8,0x00},
+        {0x87,0x93,0x0a,0x78,0xc8,0x00}, {0x16,0xc0,0xf4,0x8d,0xc8,0x00},
+        {0x00,0x00,0x00,0x20,0xc8,0x00}, {0x00,0x00,0x00,0x20,0xc8,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* r */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0xe8,0x90,0xf8,0xe4,0x00,0x00},
+        {0xfc,0x60,0x07,0x00,0x00,0x00}, {0xed,0x00,0x00,0x00,0x00,0x00},
+        {0xe8,0x00,0x00,0x00,0x00,0x00}, {0xe8,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* s */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x13,0xc2,0xf9,0xff,0x50,0x00},
+        {0x53,0xb4,0x05,0x00,0x00,0x00}, {0x0b,0x92,0xc0,0xb4,0x27,0x00},
+        {0x00,0x00,0x03,0x81,0x8a,0x00}, {0x64,0xff,0xfb,0xd0,0x2b,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* t */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0xd8,0x10,0x00,0x00,0x00},
+        {0x00,0xd8,0x10,0x00,0x00,0x00}, {0xff,0xff,0xff,0xff,0x1c,0x00},
+        {0x00,0xd8,0x10,0x00,0x00,0x00}, {0x00,0xd8,0x10,0x00,0x00,0x00},
+        {0x00,0xce,0x36,0x00,0x00,0x00}, {0x00,0x68,0xf0,0xff,0x1c,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* u */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x8c,0x58,0x00,0x44,0xa0,0x00},
+        {0x8c,0x58,0x00,0x44,0xa0,0x00}, {0x8b,0x58,0x00,0x47,0xa0,0x00},
+        {0x77,0x8e,0x0a,0x97,0xa0,0x00}, {0x1e,0xd7,0xeb,0x8c,0xa0,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* v */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0xd0,0x1e,0x00,0x1b,0xd2,0x00},
+        {0x6f,0x7d,0x00,0x79,0x72,0x00}, {0x12,0xd5,0x01,0xd2,0x15,0x00},
+        {0x00,0xa7,0x78,0xac,0x00,0x00}, {0x00,0x42,0xfc,0x49,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* w */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0xd8,0x00,0x00,0x00,0x1c,0xc2},
+        {0xbd,0x1b,0x00,0x00,0x56,0x81}, {0x7c,0x55,0xa4,0x71,0x8f,0x3f},
+        {0x3b,0x9f,0x8c,0x9d,0xbf,0x07}, {0x05,0xf1,0x34,0x6f,0xb9,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* x */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x88,0x76,0x00,0x72,0x8a,0x00},
+        {0x02,0xb1,0x80,0xb3,0x02,0x00}, {0x00,0x33,0xff,0x36,0x00,0x00},
+        {0x0e,0xc9,0x50,0xca,0x10,0x00}, {0xb3,0x52,0x00,0x4c,0xb8,0x03},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* y */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0xcf,0x1c,0x00,0x1c,0xd2,0x01},
+        {0x62,0x83,0x00,0x81,0x67,0x00}, {0x07,0xd0,0x09,0xd2,0x0a,0x00},
+        {0x00,0x7e,0xa9,0x8a,0x00,0x00}, {0x00,0x16,0xfd,0x27,0x00,0x00},
+        {0x00,0x5e,0xc0,0x00,0x00,0x00}, {0xa8,0xe2,0x34,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* z */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x74,0xff,0xff,0xff,0x78,0x00},
+        {0x00,0x00,0x14,0x8d,0x06,0x00}, {0x00,0x0f,0x90,0x09,0x00,0x00},
+        {0x0b,0x91,0x0e,0x00,0x00,0x00}, {0x89,0xff,0xff,0xff,0x84,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* { */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0xa1,0xf4,0x40,0x00}, {0x00,0x0c,0xe4,0x0d,0x00,0x00},
+        {0x00,0x18,0xcf,0x00,0x00,0x00}, {0x01,0x4b,0xbd,0x00,0x00,0x00},
+        {0x9c,0xfc,0x53,0x00,0x00,0x00}, {0x01,0x5c,0xbd,0x00,0x00,0x00},
+        {0x00,0x1a,0xcf,0x00,0x00,0x00}, {0x00,0x0c,0xe4,0x0c,0x00,0x00},
+        {0x00,0x00,0xa3,0xf5,0x40,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* | */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0xd4,0x00,0x00,0x00}, {0x00,0x00,0xd4,0x00,0x00,0x00},
+        {0x00,0x00,0xd4,0x00,0x00,0x00}, {0x00,0x00,0xd4,0x00,0x00,0x00},
+        {0x00,0x00,0xd4,0x00,0x00,0x00}, {0x00,0x00,0xd4,0x00,0x00,0x00},
+        {0x00,0x00,0xd4,0x00,0x00,0x00}, {0x00,0x00,0xd4,0x00,0x00,0x00},
+        {0x00,0x00,0xd4,0x00,0x00,0x00}, {0x00,0x00,0xd4,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* } */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0xf8,0xc3,0x0a,0x00,0x00,0x00}, {0x06,0xba,0x40,0x00,0x00,0x00},
+        {0x00,0x9c,0x4c,0x00,0x00,0x00}, {0x00,0x8a,0x7b,0x03,0x00,0x00},
+        {0x00,0x2b,0xf2,0xd0,0x00,0x00}, {0x00,0x8a,0x8a,0x04,0x00,0x00},
+        {0x00,0x9b,0x4e,0x00,0x00,0x00}, {0x05,0xb8,0x40,0x00,0x00,0x00},
+        {0xf9,0xc6,0x0a,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    },
+    { /* ~ */
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x66,0xec,0xb8,0x28,0x3d,0x48}, {0x71,0x14,0x55,0xdf,0xc5,0x14},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}, {0x00,0x00,0x00,0x00,0x00,0x00},
+        {0x00,0x00,0x00,0x00,0x00,0x00}
+    }
+};
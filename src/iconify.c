@@ -25,14 +25,15 @@
 #define _POSIX_C_SOURCE 200809L
 
 /* Standard library includes */
+#include <limits.h>     /* INT_MAX, INT_MIN */
+#include <poll.h>       /* poll, pollfd, POLLIN */
 #include <stdio.h>      /* fprintf, snprintf */
 #include <stdlib.h>     /* abs, free, malloc */
-#include <string.h>     /* strdup (POSIX.1-2008), strlen */
-#include <sys/stat.h>   /* stat */
-#include <unistd.h>     /* access */
+#include <string.h>     /* memset, strcmp, strdup (POSIX.1-2008), ... */
 
 /* X includes */
 #include <X11/Xlib.h>   /* Bool, False, True, Display, Pixmap, Window, X* */
+#include <X11/Xutil.h>  /* XDestroyImage */
 #include <X11/xpm.h>    /* XClassHint, XGetPIxel, XSetStandardProperties */
 
 /* To avoid including <X11/Xatom.h> just for the definition of 'XA_ATOM' */
@@ -41,39 +42,124 @@
 #endif
 
 /* Local includes */
+#include <atoms.h>
+#include <backend.h>
+#include <cache.h>
+#include <compose.h>
 #include <defaults.h>
+#include <drag.h>
 #include <iconify.h>
+#include <live.h>
+#include <netwm.h>
+#include <pixbuf.h>
+#include <pyramid.h>
+#include <registry.h>
+#include <render.h>
+#include <scale.h>
+#include <snapshot.h>
+#include <theme.h>
+#include <trace.h>
+#include <upload.h>
 
 
 /* Initialize a new icon */
 icon_td *icon_init(Display *display, Window window_orig,
-        Pixmap pixmap, char *prog_name, const char *path,
+        const char *prog_name, const char *path,
+        unsigned int border, unsigned int width, unsigned int height,
+        unsigned long text_bg, unsigned long text_fg,
+        unsigned long frame_c, Bool show_text)
+{
+    /* Ask everything about the original window at once: its class,
+     * shared by the name and the icon lookup, and its position */
+    window_info_td info;
+    trace_span_td span;
+    trace_begin(&span, display, TRACE_INIT);
+    window_info_get(display, window_orig,
+            (strcmp(path, DEFAULT_ICON_PATH) == 0), &info);
+    trace_end(&span);
+
+    return icon_init_info(display, window_orig, &info, prog_name, path,
+            border, width, height, text_bg, text_fg, frame_c, show_text);
+}
+
+
+/* Initialize a new icon, from its window already queried */
+icon_td *icon_init_info(Display *display, Window window_orig,
+        window_info_td *info, const char *prog_name, const char *path,
         unsigned int border, unsigned int width, unsigned int height,
         unsigned long text_bg, unsigned long text_fg,
         unsigned long frame_c, Bool show_text)
 {
     icon_td *icon;
 
+    if (!info->exists) {
+        window_info_free(info);
+        return NULL;
+    }
+
     /* Allocate memory */
     icon = malloc(sizeof(icon_td));
     if (!icon) {
+        window_info_free(info);
         return NULL;
     }
 
     /* Set initial values */
     icon->display = display;
     icon->window_orig = window_orig;
-    icon->pixmap = pixmap;
+    icon->orig_destroyed = False;
+    icon->pixmap = None;
+    icon->pixmap_key = REGISTRY_NONE;
+    icon->pixmap_alpha = False;
+    icon->src_width = DEFAULT_WIDTH;
+    icon->src_height = DEFAULT_HEIGHT;
     icon->border = border;
     icon->width = width;
     icon->height = height;
     icon->path = strdup(path);
+    icon->source = ICON_SOURCE_NONE;
+    icon->source_key = 0;
+    icon->group = NULL;
+    icon->caption = NULL;
+    icon->caption_width = 0;
     icon->x_pos = 240;
     icon->y_pos = 240;
     icon->bg = text_bg;     /* Text background color */
     icon->fg = text_fg;     /* Text foreground color */
     icon->fc = frame_c;     /* Frame color */
     icon->show_text = show_text;
+    icon->filter = DEFAULT_SCALE_FILTER;
+    icon->snapshot = False;
+    icon->snapshot_job = NULL;
+    icon->live_rate = 0;
+    icon->live = NULL;
+    icon->hidden = False;
+    icon->backing = None;
+    icon->backing_key = REGISTRY_NONE;
+    icon->backing_width = 0;
+    icon->backing_height = 0;
+    icon->gc = NULL;
+    icon->dirty = True;
+    icon->window = None;
+    drag_init(&icon->drag, DEFAULT_DRAG_RATE);
+    icon->last_click = 0;
+    icon->x0_exposed = icon->y0_exposed = INT_MAX;
+    icon->x1_exposed = icon->y1_exposed = INT_MIN;
+
+    icon->res_name = info->res_name;    /* The icon owns the strings */
+    icon->res_class = info->res_class;
+    info->res_name = info->res_class = NULL;
+    icon->netwm_read = info->icon_read;
+    icon->netwm_icon = netwm_icon_choose(info->icon, info->icon_length,
+            width, height);
+    window_info_free(info);     /* Only the icon chosen is kept */
+    icon->orig_x = info->x;
+    icon->orig_y = info->y;
+    icon->x_pos = (info->x < 0) ? 240 : info->x;
+    icon->y_pos = (info->y < 0) ? 240 : info->y;
+    icon->place.x_anchor = icon->x_pos;
+    icon->place.y_anchor = icon->y_pos;
+    icon->place.placed = False;
 
     /* Use program name to set the name of icon window */
     if (prog_name) {
@@ -81,11 +167,8 @@ icon_td *icon_init(Display *display, Window window_orig,
     } else {
         /* If there's no name, use original window name */
         char name[MAX_APP_NAME_LENGTH] = "Unknown"; /* Default name */
-        XClassHint class_hint;
-        if (XGetClassHint(display, window_orig, &class_hint)) {
-            snprintf(name, sizeof(name), "%s", class_hint.res_name);
-            XFree(class_hint.res_name);
-            XFree(class_hint.res_class);
+        if (icon->res_name) {
+            snprintf(name, sizeof(name), "%s", icon->res_name);
         }
         icon->prog_name = strdup(name);
     }
@@ -94,12 +177,108 @@ icon_td *icon_init(Display *display, Window window_orig,
 }
 
 
+/* Add or remove states of the original window, through the window
+ * manager, as a pager would */
+static void _window_state_change(icon_td *icon, long action, atom_td first,
+        atom_td second)
+{
+    const Atom *atoms = atoms_get(icon->display);
+    XEvent event;
+
+    memset(&event, 0, sizeof(event));
+    event.xclient.type = ClientMessage;
+    event.xclient.window = icon->window_orig;
+    event.xclient.message_type = atoms[ATOM_NET_WM_STATE];
+    event.xclient.format = 32;
+    event.xclient.data.l[0] = action;   /* 0: remove, 1: add */
+    event.xclient.data.l[1] = (long) atoms[first];
+    event.xclient.data.l[2] = (long) atoms[second];
+    event.xclient.data.l[3] = 2;        /* Source: a pager */
+    XSendEvent(icon->display, DefaultRootWindow(icon->display), False,
+            SubstructureRedirectMask | SubstructureNotifyMask, &event);
+}
+
+
+/* Minimize original window; same as 'XIconifyWindow', but without
+ * interning 'WM_CHANGE_STATE' again */
+static void _window_iconify(icon_td *icon)
+{
+    XEvent event;
+
+    memset(&event, 0, sizeof(event));
+    event.xclient.type = ClientMessage;
+    event.xclient.window = icon->window_orig;
+    event.xclient.message_type =
+        atoms_get(icon->display)[ATOM_WM_CHANGE_STATE];
+    event.xclient.format = 32;
+    event.xclient.data.l[0] = IconicState;
+    XSendEvent(icon->display, DefaultRootWindow(icon->display), False,
+            SubstructureRedirectMask | SubstructureNotifyMask, &event);
+}
+
+
+/* Keep the original window viewable, so that it keeps drawing and its
+ * damage is reported, but out of sight: past the bottom right corner of
+ * the screen, below every other window, and out of taskbars and pagers */
+static void _window_hide(icon_td *icon)
+{
+    int screen = DefaultScreen(icon->display);
+
+    _window_state_change(icon, 1, ATOM_NET_WM_STATE_SKIP_TASKBAR,
+            ATOM_NET_WM_STATE_SKIP_PAGER);
+    _window_state_change(icon, 1, ATOM_NET_WM_STATE_BELOW,
+            ATOM_NET_WM_STATE_BELOW);
+    XMoveWindow(icon->display, icon->window_orig,
+            DisplayWidth(icon->display, screen),
+            DisplayHeight(icon->display, screen));
+    XLowerWindow(icon->display, icon->window_orig);
+    icon->hidden = True;
+}
+
+
+/* Put a hidden original window back where it was, on top */
+static void _window_show(icon_td *icon)
+{
+    _window_state_change(icon, 0, ATOM_NET_WM_STATE_SKIP_TASKBAR,
+            ATOM_NET_WM_STATE_SKIP_PAGER);
+    _window_state_change(icon, 0, ATOM_NET_WM_STATE_BELOW,
+            ATOM_NET_WM_STATE_BELOW);
+    XMoveWindow(icon->display, icon->window_orig,
+            (icon->orig_x < 0) ? 0 : icon->orig_x,
+            (icon->orig_y < 0) ? 0 : icon->orig_y);
+    XRaiseWindow(icon->display, icon->window_orig);
+    icon->hidden = False;
+}
+
+
 /* Destroy icon structure and free resources */
 void icon_destroy(icon_td *icon)
 {
     if (icon) {
-        if (icon->pixmap) {
-            XFreePixmap(icon->display, icon->pixmap);
+        if (icon->snapshot_job) {
+            XImage *thumbnail = snapshot_finish(icon->snapshot_job,
+                    NULL, NULL);
+            if (thumbnail) {
+                XDestroyImage(thumbnail);
+            }
+        }
+        pixbuf_destroy(icon->netwm_icon);
+        live_stop(icon->live, icon->orig_destroyed);
+        if (icon->window && !icon->orig_destroyed) {
+            /* Its events are of no use without the icon */
+            XSelectInput(icon->display, icon->window_orig, NoEventMask);
+        }
+        if (icon->hidden && !icon->orig_destroyed) {
+            /* Nothing else would bring it back */
+            _window_show(icon);
+        }
+        registry_release(icon->display, icon->pixmap_key, icon->pixmap);
+        registry_release(icon->display, icon->backing_key, icon->backing);
+        if (icon->gc) {
+            XFreeGC(icon->display, icon->gc);
+        }
+        if (icon->window) {
+            XDestroyWindow(icon->display, icon->window);
         }
         if (icon->prog_name) {
             free(icon->prog_name);
@@ -107,6 +286,10 @@ void icon_destroy(icon_td *icon)
         if (icon->path) {
             free(icon->path);
         }
+        free(icon->res_name);
+        free(icon->res_class);
+        free(icon->group);
+        free(icon->caption);
         free(icon);
     }
 }
@@ -115,80 +298,42 @@ void icon_destroy(icon_td *icon)
 /* Create new icon window */
 void icon_create(icon_td *icon)
 {
-    XWindowAttributes attributes;
-    Window current_window = icon->window_orig;
-    int absolute_x = 0;
-    int absolute_y = 0;
-
-    /* Follow window hierarchy until root to get absolute coordinates */
-    while (current_window != 0) {
-        /* Get current window attributes */
-        if (!XGetWindowAttributes(icon->display, current_window,
-                    &attributes)) {
-            fprintf(stderr, "Cannot get window properties\n");
-            return;
-        }
+    const Atom *atoms = atoms_get(icon->display);
+    trace_span_td span;
 
-        /* Get absolute coordinates by accumulation of parent windows
-         * coordintes, only if visible */
-        if (attributes.map_state == IsViewable) {
-            absolute_x += attributes.x;
-            absolute_y += attributes.y;
-        }
-
-        /* Get parent window until root window */
-        Window root;
-        Window parent;
-        Window *children;
-        unsigned int num_children;
-
-        /* Get widnow hierarchy */
-        if (XQueryTree(icon->display, current_window, &root, &parent,
-                    &children, &num_children)) {
-            current_window = parent;    /* Move to parent window */
-            XFree(children);
-        } else {
-            fprintf(stderr, "Cannot obtain window hierarchy\n");
-            break;
-        }
-    }
-
-    /* Set icon coordinates */
-    icon->x_pos = (absolute_x < 0) ? 240 : absolute_x;
-    icon->y_pos = (absolute_y < 0) ? 240 : absolute_y;
+    trace_begin(&span, icon->display, TRACE_CREATE);
 
     /* Set icon height depending on whether text is displayed or not */
-    unsigned int window_height = icon->height +
-        ((icon->show_text) ? DEFAULT_TEXT_HEIGHT : 0) + 2 * icon->border;
+    compose_layout_td layout;
+    compose_layout(icon, &layout);
 
     /* Create icon by reading original window coordinates (top, left) */
     icon->window = XCreateSimpleWindow(icon->display,
             DefaultRootWindow(icon->display), icon->x_pos, icon->y_pos,
-            icon->width + 2 * icon->border, window_height,
+            layout.width, layout.height,
             0,
             BlackPixel(icon->display, 0), WhitePixel(icon->display, 0));
 
-    /* Set the 'override_redirect' property: no WM interference */
+    /* Set the 'override_redirect' property: no WM interference; the
+     * server does not clear exposed areas, the backing pixmap covers
+     * the whole window */
     XSetWindowAttributes windowAttributes;
     windowAttributes.override_redirect = True;
+    windowAttributes.background_pixmap = None;
     XChangeWindowAttributes(icon->display, icon->window,
-            CWOverrideRedirect, &windowAttributes);
+            CWOverrideRedirect | CWBackPixmap, &windowAttributes);
 
     /* Make sure the icon window is on the desktop, and not above it */
-    Atom wm_window_type = XInternAtom(icon->display,
-            "_NET_WM_WINDOW_TYPE", False);
-    Atom wm_window_type_desktop = XInternAtom(icon->display,
-            "_NET_WM_WINDOW_TYPE_DESKTOP", False);
-    XChangeProperty(icon->display, icon->window, wm_window_type,
-            XA_ATOM, 32/*bits*/, PropModeReplace,
-            (unsigned char *) &wm_window_type_desktop, 1);
+    XChangeProperty(icon->display, icon->window,
+            atoms[ATOM_NET_WM_WINDOW_TYPE], XA_ATOM, 32/*bits*/,
+            PropModeReplace,
+            (const unsigned char *) &atoms[ATOM_NET_WM_WINDOW_TYPE_DESKTOP],
+            1);
 
     /* Just to make sure the icon cannot be on top of other windows */
-    Atom wm_state = XInternAtom(icon->display, "_NET_WM_STATE", False);
-    Atom wm_state_lower = XInternAtom(icon->display,
-            "_NET_WM_STATE_BELOW", False);
-    XChangeProperty(icon->display, icon->window, wm_state, XA_ATOM,
-            32, PropModeReplace, (unsigned char *) &wm_state_lower, 1);
+    XChangeProperty(icon->display, icon->window,
+            atoms[ATOM_NET_WM_STATE], XA_ATOM, 32, PropModeReplace,
+            (const unsigned char *) &atoms[ATOM_NET_WM_STATE_BELOW], 1);
 
     /* Set window properties */
     XSetStandardProperties(icon->display, icon->window,
@@ -199,6 +344,11 @@ void icon_create(icon_td *icon)
             ExposureMask        |   ButtonPressMask     |
             ButtonReleaseMask   |   PointerMotionMask);
 
+    /* Follow the original window, to close the icon when it is gone or
+     * shown again by someone else; selected before it is iconified, so
+     * that no change is missed */
+    XSelectInput(icon->display, icon->window_orig, StructureNotifyMask);
+
     /* Draw the icon */
     icon_draw(icon);
 
@@ -206,212 +356,741 @@ void icon_create(icon_td *icon)
     XMapWindow(icon->display, icon->window);
     XLowerWindow(icon->display, icon->window);
 
-    /* Minimize original window */
-    XIconifyWindow(icon->display, icon->window_orig,
-            DefaultScreen(icon->display));
+    /* Capture the original window while it is still mapped; its
+     * thumbnail replaces the icon once reduced */
+    if (icon->snapshot) {
+        unsigned int src_width, src_height;
+        XImage *capture = snapshot_capture(icon->display,
+                icon->window_orig, icon->width, icon->height,
+                &src_width, &src_height);
+        if (capture) {
+            icon->snapshot_job = snapshot_start(icon->display, capture,
+                    src_width, src_height, icon->width, icon->height,
+                    icon->window, atoms[ATOM_ICONIFY_SNAPSHOT]);
+        }
+    }
+
+    /* A live thumbnail needs the window to keep drawing: it is only put
+     * out of sight; any other window is iconified */
+    if (icon->snapshot_job && icon->live_rate > 0 &&
+            live_available(icon->display)) {
+        _window_hide(icon);
+    } else {
+        _window_iconify(icon);
+    }
+    trace_end(&span);
 }
 
 
-/* Draw icon and its text on its window */
-void icon_draw(icon_td *icon)
+/* Key of the composed icon, or 'REGISTRY_NONE' if its pixmap is not
+ * shared, and so may change under it */
+static uint64_t _backing_key(const icon_td *icon,
+        const compose_layout_td *layout)
+{
+    struct {
+        uint64_t pixmap_key;
+        unsigned long bg, fg, fc;
+        unsigned int border;
+        int filter;
+    } look;
+
+    if (icon->pixmap_key == REGISTRY_NONE) {
+        return REGISTRY_NONE;
+    }
+    memset(&look, 0, sizeof(look));     /* No padding garbage */
+    look.pixmap_key = icon->pixmap_key;
+    look.bg = icon->bg;
+    look.fg = icon->fg;
+    look.fc = icon->fc;
+    look.border = icon->border;
+    look.filter = (int) icon->filter;
+
+    uint64_t key = registry_key(REGISTRY_SEED, &look, sizeof(look));
+    key = registry_key(key, layout, sizeof(*layout));
+    return registry_key(key, icon->prog_name, strlen(icon->prog_name));
+}
+
+
+/* Compose the icon, its border and its text on the backing pixmap */
+static void _icon_compose(icon_td *icon)
 {
-    /* Scale pixmap */
-    Pixmap scaled_pixmap = pixmap_scale(icon->display, icon->pixmap,
-            DEFAULT_WIDTH/*px*/, DEFAULT_HEIGHT/*px*/,
-            icon->width/*px*/, icon->height/*px*/);
+    compose_layout_td layout;
+
+    /* Same layout as the renderer without X (see 'compose.h') */
+    compose_layout(icon, &layout);
+    uint64_t key = _backing_key(icon, &layout);
+    if (!icon->gc) {
+        icon->gc = XCreateGC(icon->display, icon->window, 0, NULL);
+    }
 
-    /* Clear window */
-    XSetWindowBackground(icon->display, icon->window,
-            WhitePixel(icon->display, DefaultScreen(icon->display)));
-    XClearWindow(icon->display, icon->window);
+    /* Let the backing pixmap go if it is not the one to draw on: shared,
+     * or of another size */
+    if (icon->backing != None && (key != icon->backing_key ||
+                icon->backing_key != REGISTRY_NONE ||
+                icon->backing_width != layout.width ||
+                icon->backing_height != layout.height)) {
+        if (key != REGISTRY_NONE && key == icon->backing_key) {
+            icon->dirty = False;    /* Shared, and still the same */
+            return;
+        }
+        registry_release(icon->display, icon->backing_key, icon->backing);
+        icon->backing = None;
+    }
 
-    /* Draw border */
+    /* Use the one of another icon that looks the same, if any */
+    if (icon->backing == None && key != REGISTRY_NONE) {
+        icon->backing = registry_get(icon->display, key,
+                &icon->backing_width, &icon->backing_height, NULL);
+        if (icon->backing != None) {
+            icon->backing_key = key;
+            icon->dirty = False;
+            return;
+        }
+    }
+    if (icon->backing == None) {
+        icon->backing = XCreatePixmap(icon->display, icon->window,
+                layout.width, layout.height,
+                (unsigned int) DefaultDepth(icon->display,
+                    DefaultScreen(icon->display)));
+        icon->backing_key = key;
+        icon->backing_width = layout.width;
+        icon->backing_height = layout.height;
+        registry_add(icon->display, key, icon->backing,
+                layout.width, layout.height, False);
+    }
+
+    /* Draw border, or just clear the pixmap if there is no border */
+    XSetForeground(icon->display, icon->gc, (icon->border > 0) ?
+            icon->fc : WhitePixel(icon->display, 0));    /* FC color */
+    XFillRectangle(icon->display, icon->backing, icon->gc, 0, 0,
+            layout.width, layout.height);
+
+    /* Reset the icon area behind border */
     if (icon->border > 0) {
-        GC gc = XCreateGC(icon->display, icon->window, 0, NULL);
-        unsigned int total_height = icon->height +
-            ((icon->show_text) ? DEFAULT_TEXT_HEIGHT : 0) +
-                2 * icon->border;
-
-        /* Adjust border depending on its thinkness */
-        XSetForeground(icon->display, gc, icon->fc);    /* FC color */
-        XFillRectangle(icon->display, icon->window, gc, 0, 0,
-                icon->width + 2 * icon->border,
-                total_height);
-
-        /* Reset the icon area behind border */
-        XSetForeground(icon->display, gc, WhitePixel(icon->display, 0)); 
-        XFillRectangle(icon->display, icon->window, gc,
-                       (int) icon->border, (int) icon->border,
-                       icon->width,
-                       icon->height +
-                           ((icon->show_text) ? DEFAULT_TEXT_HEIGHT : 0));
-
-        /* Free used memory */
-        XFreeGC(icon->display, gc);
-    }
-
-    /* Draw scaled pixmap */
-    XCopyArea(icon->display, scaled_pixmap, icon->window,
-            DefaultGC(icon->display, DefaultScreen(icon->display)),
-            0, 0, icon->width, icon->height,
-            (int) icon->border, (int) icon->border);
+        XSetForeground(icon->display, icon->gc,
+                WhitePixel(icon->display, 0));
+        XFillRectangle(icon->display, icon->backing, icon->gc,
+                layout.inner_x, layout.inner_y,
+                layout.inner_width, layout.inner_height);
+    }
+
+    /* Draw the pixmap: scaled and blended by the server in a single
+     * request if possible, or else scaled here first unless at size */
+    if (render_composite(icon->display, icon->pixmap, icon->pixmap_alpha,
+                icon->src_width, icon->src_height, icon->backing,
+                layout.icon_x, layout.icon_y,
+                layout.icon_width, layout.icon_height, icon->filter)) {
+        /* Already drawn */
+    } else if (icon->src_width == layout.icon_width &&
+            icon->src_height == layout.icon_height) {
+        XCopyArea(icon->display, icon->pixmap, icon->backing, icon->gc,
+                0, 0, layout.icon_width, layout.icon_height,
+                layout.icon_x, layout.icon_y);
+    } else {
+        Pixmap scaled_pixmap = pixmap_scale(icon->display, icon->pixmap,
+                icon->src_width/*px*/, icon->src_height/*px*/,
+                layout.icon_width/*px*/, layout.icon_height/*px*/,
+                icon->filter);
+        if (scaled_pixmap != None) {
+            XCopyArea(icon->display, scaled_pixmap, icon->backing,
+                    icon->gc, 0, 0, layout.icon_width, layout.icon_height,
+                    layout.icon_x, layout.icon_y);
+            XFreePixmap(icon->display, scaled_pixmap);
+        }
+    }
 
     /* Show icon text */
-    if (icon->show_text) {
+    if (layout.caption_height > 0) {
         /* Set the text background */
-        GC gc = XCreateGC(icon->display, icon->window, 0, NULL);
+        XSetForeground(icon->display, icon->gc, icon->bg); /* BG color */
+        XFillRectangle(icon->display, icon->backing, icon->gc,
+                layout.caption_x, layout.caption_y,
+                layout.caption_width, layout.caption_height);
+
+        /* Lay the name out once for this width; it does not change */
+        if (!icon->caption || icon->caption_width != layout.caption_width) {
+            free(icon->caption);
+            icon->caption = compose_caption(icon->prog_name,
+                    layout.caption_width);
+            icon->caption_width = layout.caption_width;
+        }
 
-        XSetForeground(icon->display, gc, icon->bg); /* BG color */
-        XFillRectangle(icon->display, icon->window, gc,
-                (int) icon->border,
-                (int) (icon->height + icon->border),
-                icon->width, DEFAULT_TEXT_HEIGHT);
+        /* Draw icon text, from the glyphs on the server if possible */
+        if (icon->caption && !render_text(icon->display, icon->backing,
+                    layout.text_x, layout.text_y, icon->caption,
+                    strlen(icon->caption), icon->fg)) {
+            XSetForeground(icon->display, icon->gc, icon->fg);
+            XDrawString(icon->display, icon->backing, icon->gc,
+                    layout.text_x, layout.text_y,
+                    icon->caption, (int) strlen(icon->caption));
+        }
+    }
+
+    icon->dirty = False;
+}
 
-        /* Draw icon text */
-        XSetForeground(icon->display, gc, icon->fg); /* FG color */
-        XDrawString(icon->display, icon->window, gc,
-                DEFAULT_TEXT_LOFFSET + (int) icon->border,
-                (int) (icon->height + icon->border + DEFAULT_TEXT_VOFFSET),
-                icon->prog_name, (int) strlen(icon->prog_name));
 
-        /* Clear and free the graphics context */
-        XFreeGC(icon->display, gc);
+/* Mark the composed icon as outdated */
+void icon_invalidate(icon_td *icon)
+{
+    /* The name may have changed too: lay the caption out again */
+    free(icon->caption);
+    icon->caption = NULL;
+    icon->caption_width = 0;
+    icon->dirty = True;
+}
+
+
+/* Copy a region of the composed icon on its window */
+static void _icon_copy(icon_td *icon, int x, int y,
+        unsigned int width, unsigned int height)
+{
+    if (icon->dirty || icon->backing == None) {
+        _icon_compose(icon);
     }
 
-    /* Free scaled pixmap */
-    XFreePixmap(icon->display, scaled_pixmap);
+    XCopyArea(icon->display, icon->backing, icon->window, icon->gc,
+            x, y, width, height, x, y);
 }
 
 
-/* Load icon given original window */
-Pixmap icon_load(Display *display, const char *path, Window window_orig)
+/* Draw icon and its text on its window */
+void icon_draw(icon_td *icon)
 {
-    Pixmap pixmap = None;
+    trace_span_td span;
 
-    /* Try to load icon using path and load it if exists */
-    if (access(path, F_OK) != -1) {
-        if (XpmReadFileToPixmap(display, DefaultRootWindow(display),
-                    path, &pixmap, NULL, NULL) == XpmSuccess) {
-            return pixmap;
+    trace_begin(&span, icon->display, TRACE_DRAW);
+    if (icon->dirty || icon->backing == None) {
+        _icon_compose(icon);
+    }
+    _icon_copy(icon, 0, 0, icon->backing_width, icon->backing_height);
+    trace_end(&span);
+}
+
+
+/* Draw a region of the icon on its window */
+void icon_expose(icon_td *icon, int x, int y,
+        unsigned int width, unsigned int height)
+{
+    trace_span_td span;
+
+    trace_begin(&span, icon->display, TRACE_DRAW);
+    _icon_copy(icon, x, y, width, height);
+    trace_end(&span);
+}
+
+
+/* Decode an icon file and scale it to the icon size */
+static XImage *_icon_file_decode(icon_td *icon, const char *path)
+{
+    XpmAttributes attributes;
+    XImage *image = NULL;
+
+    /* Native reader first; it is faster, but knows fewer color names.
+     * It also reads the variants of the file at other sizes, to scale
+     * from the closest larger one */
+    pyramid_td *pyramid = pyramid_load(path);
+    if (pyramid) {
+        pixbuf_td *scaled = pyramid_scale(pyramid, icon->width,
+                icon->height, icon->filter);
+        pyramid_destroy(pyramid);
+        if (!scaled) {
+            return NULL;
         }
+        image = pixbuf_to_image(icon->display, scaled,
+                0xFFFFFF/*white, as the icon area*/);
+        pixbuf_destroy(scaled);
+        return image;
     }
 
-    /* Try to load icon by using the original window class */
-    XClassHint class_hint;
-    if (XGetClassHint(display, window_orig, &class_hint)) {
-        char icon_name[MAX_APP_NAME_LENGTH];
-        snprintf(icon_name, sizeof(icon_name),
-                "/usr/share/pixmaps/%s.xpm", class_hint.res_class);
-        struct stat buffer;
-        if (stat(icon_name, &buffer) == 0) {
-            /* If exists, load it */
-            if (XpmReadFileToPixmap(display, DefaultRootWindow(display),
-                        icon_name, &pixmap, NULL, NULL) == XpmSuccess) {
-                XFree(class_hint.res_name);
-                XFree(class_hint.res_class);
-                return pixmap;
-            }
+    attributes.valuemask = 0;
+    if (XpmReadFileToImage(icon->display, path, &image, NULL,
+                &attributes) != XpmSuccess || !image) {
+        return NULL;
+    }
+    XpmFreeAttributes(&attributes);
+
+    XImage *scaled = image_scale(icon->display, image,
+            icon->width, icon->height, icon->filter);
+    XDestroyImage(image);
+
+    return scaled;
+}
+
+
+/* Set the pixmap of the icon, with its key and its size */
+static void _icon_pixmap_set(icon_td *icon, Pixmap pixmap, uint64_t key,
+        unsigned int width, unsigned int height, Bool alpha)
+{
+    icon->pixmap = pixmap;
+    icon->pixmap_key = key;
+    icon->pixmap_alpha = alpha;
+    icon->src_width = width;
+    icon->src_height = height;
+}
+
+
+/* Key of the icon of a file: the file and its variants, as they are
+ * now, and the icon size and filter; the same file has the same
+ * content, whatever its path */
+static uint64_t _file_key(const icon_td *icon, uint64_t stamp)
+{
+    unsigned int size[3] = {
+        icon->width, icon->height, (unsigned int) icon->filter
+    };
+
+    uint64_t key = registry_key(REGISTRY_SEED, &stamp, sizeof(stamp));
+    return registry_key(key, size, sizeof(size));
+}
+
+
+/* Load an icon file, if it exists, with its size */
+static Pixmap _icon_file_load(icon_td *icon, const char *path)
+{
+    uint64_t stamp;
+
+    if (pyramid_stamp(path, &stamp) != 0) {
+        return None;
+    }
+
+    /* Share the icon of another window from the same file, if any */
+    uint64_t key = _file_key(icon, stamp);
+    Pixmap pixmap = registry_get(icon->display, key, NULL, NULL, NULL);
+    if (pixmap != None) {
+        _icon_pixmap_set(icon, pixmap, key, icon->width, icon->height,
+                False);
+        return pixmap;
+    }
+
+    /* Use the icon decoded and scaled by a previous run, if still valid */
+    pixmap = cache_pixmap_load(icon->display, path, stamp,
+            icon->width, icon->height, (int) icon->filter);
+    if (pixmap == None) {
+        /* Decode and scale it once, and keep it for the next run */
+        XImage *scaled = _icon_file_decode(icon, path);
+        if (!scaled) {
+            return None;
         }
+        cache_image_store(icon->display, path, stamp, scaled,
+                (int) icon->filter);
 
-        XFree(class_hint.res_name);
-        XFree(class_hint.res_class);
+        pixmap = XCreatePixmap(icon->display,
+                DefaultRootWindow(icon->display), icon->width, icon->height,
+                (unsigned int) scaled->depth);
+        upload_image(icon->display, pixmap,
+                DefaultGC(icon->display, DefaultScreen(icon->display)),
+                scaled, 0, 0, 0, 0, icon->width, icon->height);
+        XDestroyImage(scaled);
     }
 
-    /* Load default icon if cannot be found */
-    if (XpmReadFileToPixmap(display, DefaultRootWindow(display),
-                DEFAULT_ICON_PATH, &pixmap, NULL, NULL) == XpmSuccess) {
+    registry_add(icon->display, key, pixmap, icon->width, icon->height,
+            False);
+    _icon_pixmap_set(icon, pixmap, key, icon->width, icon->height, False);
+
+    return pixmap;
+}
+
+
+/* Key of the icon published by a window: its pixels and their size */
+static uint64_t _netwm_key(const pixbuf_td *pixbuf)
+{
+    unsigned int size[2] = { pixbuf->width, pixbuf->height };
+    uint64_t key = registry_key(REGISTRY_SEED, pixbuf->data,
+            (size_t) pixbuf->width * pixbuf->height *
+            sizeof(*pixbuf->data));
+
+    return registry_key(key, size, sizeof(size));
+}
+
+
+/* Load the icon published by a window, shared with the windows that
+ * publish the same one; its pixels are read from the cache if not given
+ * and not shared already */
+static Pixmap _icon_pixels_load(icon_td *icon, uint64_t source_key,
+        const pixbuf_td *pixbuf)
+{
+    /* Blended by the server, or over the white of the icon area */
+    Bool alpha = render_available(icon->display);
+    uint64_t key = registry_key(source_key, &alpha, sizeof(alpha));
+    unsigned int width, height;
+
+    Pixmap pixmap = registry_get(icon->display, key, &width, &height,
+            NULL);
+    if (pixmap == None) {
+        pixbuf_td *cached = (pixbuf) ? NULL : cache_pixbuf_load(source_key);
+        const pixbuf_td *pixels = (pixbuf) ? pixbuf : cached;
+        if (!pixels) {
+            return None;
+        }
+        pixmap = (alpha) ?
+            pixbuf_to_pixmap_argb(icon->display, pixels) :
+            pixbuf_to_pixmap(icon->display, pixels,
+                    0xFFFFFF/*white, as the icon area*/);
+        width = pixels->width;
+        height = pixels->height;
+        if (pixmap != None) {
+            registry_add(icon->display, key, pixmap, width, height, alpha);
+        }
+        pixbuf_destroy(cached);
+    }
+    if (pixmap != None) {
+        _icon_pixmap_set(icon, pixmap, key, width, height, alpha);
+        icon->source = ICON_SOURCE_NETWM;
+        icon->source_key = source_key;
+    }
+
+    return pixmap;
+}
+
+
+/* Load the icon published by the window, and keep its pixels, so that
+ * it can be loaded again without asking the window (see 'state.h') */
+static Pixmap _icon_netwm_load(icon_td *icon)
+{
+    /* As read along with the window, if it was, even if it had none */
+    pixbuf_td *pixbuf = (icon->netwm_read) ? icon->netwm_icon :
+        netwm_icon_get(icon->display, icon->window_orig, icon->width,
+                icon->height);
+    icon->netwm_icon = NULL;
+    icon->netwm_read = False;
+    if (!pixbuf) {
+        return None;
+    }
+
+    uint64_t key = _netwm_key(pixbuf);
+    Pixmap pixmap = _icon_pixels_load(icon, key, pixbuf);
+    if (pixmap != None) {
+        cache_pixbuf_store(key, pixbuf);
+    }
+    pixbuf_destroy(pixbuf);
+
+    return pixmap;
+}
+
+
+/* Load the icon from the source it came from in a previous run */
+static Pixmap _icon_source_load(icon_td *icon)
+{
+    switch (icon->source) {
+        case ICON_SOURCE_FILE:
+            return _icon_file_load(icon, icon->path);
+        case ICON_SOURCE_NETWM:
+            return _icon_pixels_load(icon, icon->source_key, NULL);
+        case ICON_SOURCE_DEFAULT:
+            return _icon_file_load(icon, DEFAULT_ICON_PATH);
+        default:
+            return None;
+    }
+}
+
+
+/* Load icon given original window, trying every source in turn */
+static Pixmap _icon_load(icon_td *icon)
+{
+    Pixmap pixmap = None;
+
+    /* Straight from where it came from, if known and still there */
+    if ((pixmap = _icon_source_load(icon)) != None) {
         return pixmap;
     }
 
-    /* Return NULL pixmap otherwise */
-    return None;
+    /* Try to load icon using path, only if given by the user */
+    if (strcmp(icon->path, DEFAULT_ICON_PATH) != 0 &&
+            (pixmap = _icon_file_load(icon, icon->path)) != None) {
+        icon->source = ICON_SOURCE_FILE;
+        return pixmap;
+    }
+
+    /* Try to use the icon published by the window, at the closest size,
+     * which needs no file nor parsing */
+    if ((pixmap = _icon_netwm_load(icon)) != None) {
+        return pixmap;
+    }
+
+    /* Try to find the icon of the original window class, or of its
+     * instance, in the icon themes */
+    const char *names[2] = { icon->res_class, icon->res_name };
+    for (int i = 0; i < 2; ++i) {
+        char icon_path[MAX_PATH_LENGTH];
+        if (names[i] && theme_lookup(names[i], icon->width, icon_path,
+                    sizeof(icon_path)) &&
+                (pixmap = _icon_file_load(icon, icon_path)) != None) {
+            /* Kept, so that the icon can be loaded again without any
+             * lookup (see 'state.h') */
+            char *found = strdup(icon_path);
+            if (found) {
+                free(icon->path);
+                icon->path = found;
+                icon->source = ICON_SOURCE_FILE;
+            }
+            return pixmap;
+        }
+    }
+
+    /* Load default icon if cannot be found */
+    if ((pixmap = _icon_file_load(icon, DEFAULT_ICON_PATH)) != None) {
+        icon->source = ICON_SOURCE_DEFAULT;
+    }
+    return pixmap;
+}
+
+
+/* Load icon given original window */
+Pixmap icon_load(icon_td *icon)
+{
+    trace_span_td span;
+
+    trace_begin(&span, icon->display, TRACE_LOAD);
+    Pixmap pixmap = _icon_load(icon);
+    trace_end(&span);
+
+    return pixmap;
 }
 
 
 /* Pixmap scaling */
 Pixmap pixmap_scale(Display *display, Pixmap pixmap_orig,
                     unsigned int width_old, unsigned int height_old,
-                    unsigned int width_new, unsigned int height_new)
+                    unsigned int width_new, unsigned int height_new,
+                    scale_filter_td filter)
 {
-    /* Create a new pixmap for the scaled image */
+    /* Fetch the whole original pixmap at once */
+    XImage *image_orig = XGetImage(display, pixmap_orig, 0, 0,
+            width_old, height_old, AllPlanes, ZPixmap);
+    if (!image_orig) {
+        fprintf(stderr, "Cannot read pixmap to scale\n");
+        return None;
+    }
+
+    /* Scale the image in client memory */
+    XImage *image_new = image_scale(display, image_orig,
+            width_new, height_new, filter);
+    XDestroyImage(image_orig);
+    if (!image_new) {
+        fprintf(stderr, "Cannot allocate scaled image\n");
+        return None;
+    }
+
+    /* Create a new pixmap for the scaled image and send it at once */
     Pixmap scaled_pixmap = XCreatePixmap(display,
             DefaultRootWindow(display), width_new, height_new,
-            (unsigned int) DefaultDepth(display, DefaultScreen(display)));
-
-    /* Create a GC (graphics context) for drawing */
-    GC gc = XCreateGC(display, scaled_pixmap, 0, NULL);
-
-    /* Set the background color to white */
-    XSetForeground(display, gc, WhitePixel(display, 
-                DefaultScreen(display)));
-    XFillRectangle(display, scaled_pixmap, gc, 0, 0,
-            width_new, height_new);
-
-    /* Calculate scaling factors */
-    double x_ratio = (double)width_old / (double)width_new;
-    double y_ratio = (double)height_old / (double)height_new;
-
-    /* Scale the image by providing the scaled coordinates */
-    for (unsigned int y = 0; y < height_new; ++y) {
-        for (unsigned int x = 0; x < width_new; ++x) {
-            // Calculate the source coordinates in the original pixmap
-            int src_x = (int)(x * x_ratio);
-            int src_y = (int)(y * y_ratio);
-            
-            /* Copy a 1x1px from the original pixmap to the scaled pixmap */
-            XCopyArea(display, pixmap_orig, scaled_pixmap, gc,
-            src_x, src_y, 1, 1, (int) x, (int) y);
-        }
-    }
+            (unsigned int) image_new->depth);
+    upload_image(display, scaled_pixmap,
+            DefaultGC(display, DefaultScreen(display)), image_new,
+            0, 0, 0, 0, width_new, height_new);
 
     /* Cleanup and free resources */
-    XFreeGC(display, gc);
-    
+    XDestroyImage(image_new);
+
     return scaled_pixmap;
 }
 
 
-/* Icon mouse event handler on iconized window */
-void events_handle(icon_td *icon)
+/* Replace the icon by the thumbnail of its window, once reduced */
+static void _icon_snapshot_apply(icon_td *icon)
 {
-    XEvent event;
-    Bool dragging = False;
-    int x_drag_start = 0;
-    int y_drag_start = 0;
-
-    while (True) {
-        XNextEvent(icon->display, &event);
-        if (event.type == ClientMessage &&
-                event.xclient.data.l[0] ==
-                    (unsigned int) XInternAtom(icon->display,
-                        "WM_DELETE_WINDOW", False)) {
-            break;
+    unsigned int src_width, src_height;
+    XImage *thumbnail = snapshot_finish(icon->snapshot_job,
+            &src_width, &src_height);
+    icon->snapshot_job = NULL;
+    if (!thumbnail) {
+        return;
+    }
+
+    Pixmap pixmap = XCreatePixmap(icon->display,
+            DefaultRootWindow(icon->display), icon->width, icon->height,
+            (unsigned int) thumbnail->depth);
+    upload_image(icon->display, pixmap,
+            DefaultGC(icon->display, DefaultScreen(icon->display)),
+            thumbnail, 0, 0, 0, 0, icon->width, icon->height);
+
+    /* Keep the thumbnail to update its damaged parts, if asked to */
+    if (icon->live_rate > 0) {
+        icon->live = live_start(icon->display, icon->window_orig,
+                thumbnail, src_width, src_height, icon->live_rate);
+    }
+    if (!icon->live) {
+        XDestroyImage(thumbnail);
+    }
+
+    /* It cannot be followed after all: iconified as any other */
+    if (icon->hidden && !icon->live) {
+        _window_show(icon);
+        _window_iconify(icon);
+    }
+
+    /* The thumbnail is of this window alone, and may be updated: it is
+     * not shared */
+    registry_release(icon->display, icon->pixmap_key, icon->pixmap);
+    _icon_pixmap_set(icon, pixmap, REGISTRY_NONE, icon->width,
+            icon->height, False);
+    icon_invalidate(icon);
+    icon_draw(icon);
+}
+
+
+/* Time until the icon has to be refreshed */
+int icon_timeout(const icon_td *icon)
+{
+    int timeout = drag_timeout(&icon->drag, drag_now());
+    int live = (icon->live) ? live_timeout(icon->live) : -1;
+
+    return (timeout < 0 || (live >= 0 && live < timeout)) ? live : timeout;
+}
+
+
+/* Move the icon to the latest drag position, once per frame */
+static void _icon_drag_step(icon_td *icon)
+{
+    if (drag_step(&icon->drag, drag_now(), &icon->x_pos, &icon->y_pos)) {
+        XMoveWindow(icon->display, icon->window, icon->x_pos, icon->y_pos);
+    }
+}
+
+
+/* Move a dragged icon, and refresh the damaged parts of a live
+ * thumbnail, if due */
+void icon_refresh(icon_td *icon)
+{
+    XRectangle changed;
+
+    _icon_drag_step(icon);
+    if (!icon->live || !live_refresh(icon->live, &changed)) {
+        return;
+    }
+
+    /* Only the changed area is sent again */
+    upload_image(icon->display, icon->pixmap,
+            DefaultGC(icon->display, DefaultScreen(icon->display)),
+            icon->live->thumbnail, changed.x, changed.y,
+            changed.x, changed.y, changed.width, changed.height);
+    icon_invalidate(icon);
+    icon_draw(icon);
+}
+
+
+/* Handle a single event, whatever its type */
+static Bool _icon_event_handle(icon_td *icon, XEvent *event)
+{
+    if (icon->live && live_event(icon->live, event)) {
+        return False;
+    }
+    if (event->type == ClientMessage && icon->snapshot_job &&
+            event->xclient.message_type ==
+                atoms_get(icon->display)[ATOM_ICONIFY_SNAPSHOT]) {
+        _icon_snapshot_apply(icon);
+        return False;
+    }
+    if (event->type == ClientMessage &&
+            event->xclient.data.l[0] == (long)
+                atoms_get(icon->display)[ATOM_WM_DELETE_WINDOW]) {
+        return True;
+    }
+
+    /* The application has quit, or the window was restored through the
+     * window manager or a taskbar: the icon is of no use any more */
+    if (event->type == DestroyNotify &&
+            event->xdestroywindow.window == icon->window_orig) {
+        icon->orig_destroyed = True;
+        return True;
+    }
+    if (event->type == MapNotify &&
+            event->xmap.window == icon->window_orig) {
+        return True;
+    }
+    if (event->type == ButtonPress) {
+        /* The press grabs the pointer until the release (implicit grab),
+         * so the drag goes on even if the pointer leaves the icon */
+        if (event->xbutton.button == Button1) {
+            drag_start(&icon->drag, event->xbutton.x, event->xbutton.y);
         }
-        if (event.type == ButtonPress) {
-            if (event.xbutton.button == Button1) {
-                dragging = True;
-                x_drag_start = event.xbutton.x;
-                y_drag_start = event.xbutton.y;
+    } else if (event->type == ButtonRelease) {
+        if (event->xbutton.button == Button1) {
+            /* The icon ends where the pointer was released */
+            drag_motion(&icon->drag, event->xbutton.x_root,
+                    event->xbutton.y_root);
+            if (drag_stop(&icon->drag, &icon->x_pos, &icon->y_pos)) {
+                XMoveWindow(icon->display, icon->window,
+                        icon->x_pos, icon->y_pos);
             }
-        } else if (event.type == ButtonRelease) {
-            if (event.xbutton.button == Button1) {
-                dragging = False;
-                if (abs(event.xbutton.x - x_drag_start) <= 5 &&
-                        abs(event.xbutton.y - y_drag_start) <= 5) {
-                    static Time last_click_time = 0;
-                    if (event.xbutton.time - last_click_time <= 500) {
-                        window_restore(icon);
-                        break;
-                    }
-                    last_click_time = event.xbutton.time;
+            if (abs(event->xbutton.x - icon->drag.x_start) <= 5 &&
+                    abs(event->xbutton.y - icon->drag.y_start) <= 5) {
+                if (event->xbutton.time - icon->last_click <= 500) {
+                    window_restore(icon);
+                    return True;
                 }
+                icon->last_click = event->xbutton.time;
             }
-        } else if (event.type == MotionNotify && dragging) {
-            int x_new = event.xmotion.x_root - x_drag_start;
-            int y_new = event.xmotion.y_root - y_drag_start;
-            XMoveWindow(icon->display, icon->window, x_new, y_new);
-        } else if (event.type == Expose) {
-            icon_draw(icon);    /* Re-draws the displayed icon */
+        }
+    } else if (event->type == MotionNotify && icon->drag.active) {
+        /* Only the latest of the queued motions matters */
+        while (XCheckTypedWindowEvent(icon->display, icon->window,
+                    MotionNotify, event)) {
+            /* Skip it */
+        }
+        if (drag_motion(&icon->drag, event->xmotion.x_root,
+                    event->xmotion.y_root)) {
+            _icon_drag_step(icon);
+        }
+    } else if (event->type == Expose) {
+        /* Join the whole series, and re-draw it at its last event */
+        XExposeEvent *expose = &event->xexpose;
+        if (expose->x < icon->x0_exposed) {
+            icon->x0_exposed = expose->x;
+        }
+        if (expose->y < icon->y0_exposed) {
+            icon->y0_exposed = expose->y;
+        }
+        if (expose->x + expose->width > icon->x1_exposed) {
+            icon->x1_exposed = expose->x + expose->width;
+        }
+        if (expose->y + expose->height > icon->y1_exposed) {
+            icon->y1_exposed = expose->y + expose->height;
+        }
+        if (expose->count == 0) {
+            icon_expose(icon, icon->x0_exposed, icon->y0_exposed,
+                    (unsigned int) (icon->x1_exposed - icon->x0_exposed),
+                    (unsigned int) (icon->y1_exposed - icon->y0_exposed));
+            icon->x0_exposed = icon->y0_exposed = INT_MAX;
+            icon->x1_exposed = icon->y1_exposed = INT_MIN;
+        }
+    }
+
+    return False;
+}
+
+
+/* Handle a single event addressed to the icon window */
+Bool icon_event(icon_td *icon, XEvent *event)
+{
+    trace_span_td span;
+    int type = event->type;     /* The handler may replace the event */
+
+    trace_begin(&span, icon->display, TRACE_EVENT);
+    Bool closed = _icon_event_handle(icon, event);
+    trace_end_event(&span, type);
+
+    return closed;
+}
+
+
+/* Icon mouse event handler on iconized window */
+void events_handle(icon_td *icon)
+{
+    struct pollfd fd = { ConnectionNumber(icon->display), POLLIN, 0 };
+    XEvent event;
+
+    for (;;) {
+        trace_dump_pending(stderr);
+        while (XPending(icon->display)) {
+            XNextEvent(icon->display, &event);
+            if (icon_event(icon, &event)) {
+                return;
+            }
+        }
+        icon_refresh(icon);
+        if (!XPending(icon->display)) {
+            poll(&fd, 1, icon_timeout(icon));
         }
     }
 }
@@ -420,6 +1099,14 @@ void events_handle(icon_td *icon)
 /* Restores original window and closes icon */
 void window_restore(icon_td *icon)
 {
+    trace_span_td span;
+
+    trace_begin(&span, icon->display, TRACE_RESTORE);
     XUnmapWindow(icon->display, icon->window);
-    XMapWindow(icon->display, icon->window_orig);
+    if (icon->hidden) {
+        _window_show(icon);
+    } else {
+        XMapWindow(icon->display, icon->window_orig);
+    }
+    trace_end(&span);
 }
@@ -0,0 +1,709 @@
+/**
+ * @file imgfile.c
+ *
+ * @brief Native reader of XPM and XBM image files implementation
+ *
+ * The file is mapped in memory and every string, color and number is
+ * read where it lies.  XPM color keys of one or two characters index
+ * a direct table of pixels; longer keys go through a hash table.  XBM
+ * rows are packed into 32-bit words and expanded a word at a time.
+ */
+/*
+ * ISC License
+ * Copyright (c) 2025, J. A. Corbal <jacorbal@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS.  IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS
+ * ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF
+ * THIS SOFTWARE.
+ */
+
+/* Enable features from the POSIX.1-2008 standard */
+#define _POSIX_C_SOURCE 200809L
+
+/* Standard library includes */
+#include <fcntl.h>      /* open, O_RDONLY */
+#include <stddef.h>     /* size_t */
+#include <stdint.h>     /* uint32_t */
+#include <stdlib.h>     /* calloc, free, malloc */
+#include <string.h>     /* memchr, memcmp, memset, strcmp, strlen */
+#include <sys/mman.h>   /* mmap, munmap */
+#include <sys/stat.h>   /* fstat */
+#include <unistd.h>     /* close */
+
+/* X includes */
+#include <X11/Xlib.h>   /* Bool, False, True */
+
+/* Local includes */
+#include <imgfile.h>
+#include <pixbuf.h>
+
+
+/* Limits of the files to read */
+#define IMGFILE_MAX_FILE_SIZE (1L << 26)    /* (bytes): 64 MiB */
+#define IMGFILE_MAX_SIDE (8192)             /* (px) */
+#define IMGFILE_MAX_COLORS (1L << 20)
+#define IMGFILE_MAX_CPP (8)                 /* characters per pixel */
+
+/* Pixels; no valid XPM pixel is 0, so it marks undefined color keys */
+#define PIXEL_UNDEFINED (0x00000000u)
+#define PIXEL_TRANSPARENT (0x00FFFFFFu)     /* white, zero alpha */
+#define PIXEL_BLACK (0xFF000000u)
+#define PIXEL_WHITE (0xFFFFFFFFu)
+
+
+/**
+ * @typedef span_td
+ *
+ * @brief Piece of the mapped file, not terminated
+ */
+typedef struct {
+    const char *data;       /**< First character */
+    size_t length;          /**< Number of characters */
+} span_td;
+
+/**
+ * @typedef color_name_td
+ *
+ * @brief Color name, lowercase and without spaces, and its value
+ */
+typedef struct {
+    const char *name;       /**< Name, as in X 'rgb.txt' */
+    uint32_t rgb;           /**< Value (0xRRGGBB) */
+} color_name_td;
+
+
+/* Most common color names; any other makes the reader give up */
+static const color_name_td _color_names[] = {
+    { "black", 0x000000 },          { "white", 0xFFFFFF },
+    { "red", 0xFF0000 },            { "green", 0x00FF00 },
+    { "blue", 0x0000FF },           { "yellow", 0xFFFF00 },
+    { "cyan", 0x00FFFF },           { "magenta", 0xFF00FF },
+    { "gray", 0xBEBEBE },           { "grey", 0xBEBEBE },
+    { "darkgray", 0xA9A9A9 },       { "darkgrey", 0xA9A9A9 },
+    { "lightgray", 0xD3D3D3 },      { "lightgrey", 0xD3D3D3 },
+    { "dimgray", 0x696969 },        { "dimgrey", 0x696969 },
+    { "slategray", 0x708090 },      { "slategrey", 0x708090 },
+    { "darkslategray", 0x2F4F4F },  { "darkslategrey", 0x2F4F4F },
+    { "gainsboro", 0xDCDCDC },      { "whitesmoke", 0xF5F5F5 },
+    { "snow", 0xFFFAFA },           { "ivory", 0xFFFFF0 },
+    { "beige", 0xF5F5DC },          { "wheat", 0xF5DEB3 },
+    { "tan", 0xD2B48C },            { "khaki", 0xF0E68C },
+    { "orange", 0xFFA500 },         { "gold", 0xFFD700 },
+    { "brown", 0xA52A2A },          { "maroon", 0xB03060 },
+    { "pink", 0xFFC0CB },           { "salmon", 0xFA8072 },
+    { "purple", 0xA020F0 },         { "violet", 0xEE82EE },
+    { "orchid", 0xDA70D6 },         { "navy", 0x000080 },
+    { "navyblue", 0x000080 },       { "darkblue", 0x00008B },
+    { "lightblue", 0xADD8E6 },      { "skyblue", 0x87CEEB },
+    { "steelblue", 0x4682B4 },      { "darkred", 0x8B0000 },
+    { "darkgreen", 0x006400 },      { "forestgreen", 0x228B22 },
+    { "seagreen", 0x2E8B57 },       { "lightyellow", 0xFFFFE0 },
+};
+
+
+/* Whether a character is a blank (space or tab) */
+static inline Bool _is_blank(char c)
+{
+    return c == ' ' || c == '\t';
+}
+
+
+/* Whether a character is a decimal digit */
+static inline Bool _is_digit(char c)
+{
+    return c >= '0' && c <= '9';
+}
+
+
+/* Value of a hexadecimal digit, or -1 */
+static inline int _hex_value(char c)
+{
+    if (c >= '0' && c <= '9') {
+        return c - '0';
+    } else if (c >= 'a' && c <= 'f') {
+        return c - 'a' + 10;
+    } else if (c >= 'A' && c <= 'F') {
+        return c - 'A' + 10;
+    }
+    return -1;
+}
+
+
+/* Take the next blank-separated word of a span */
+static Bool _span_word(span_td *span, span_td *word)
+{
+    while (span->length > 0 && _is_blank(*span->data)) {
+        ++span->data;
+        --span->length;
+    }
+    word->data = span->data;
+    while (span->length > 0 && !_is_blank(*span->data)) {
+        ++span->data;
+        --span->length;
+    }
+    word->length = (size_t) (span->data - word->data);
+
+    return word->length > 0;
+}
+
+
+/* Take the next decimal number of a span */
+static Bool _span_number(span_td *span, unsigned long *value)
+{
+    span_td word;
+
+    if (!_span_word(span, &word)) {
+        return False;
+    }
+    *value = 0;
+    for (size_t i = 0; i < word.length; ++i) {
+        if (!_is_digit(word.data[i]) || *value > IMGFILE_MAX_COLORS) {
+            return False;
+        }
+        *value = *value * 10 + (unsigned long) (word.data[i] - '0');
+    }
+
+    return True;
+}
+
+
+/* Whether a span is a given word */
+static Bool _span_is(span_td span, const char *word)
+{
+    size_t length = strlen(word);
+    return span.length == length && memcmp(span.data, word, length) == 0;
+}
+
+
+/* Parse a color value: '#' and 1 to 4 hex digits per channel, 'None',
+ * 'grayN' or a known name */
+static Bool _color_parse(span_td value, uint32_t *argb)
+{
+    char name[32];
+    size_t length = 0;
+
+    if (value.length > 1 && value.data[0] == '#') {
+        size_t digits = value.length - 1;
+        size_t per_channel = digits / 3;
+        uint32_t rgb = 0;
+        if (digits % 3 != 0 || per_channel < 1 || per_channel > 4) {
+            return False;
+        }
+        for (size_t channel = 0; channel < 3; ++channel) {
+            uint32_t component = 0;
+            for (size_t i = 0; i < per_channel; ++i) {
+                int digit = _hex_value(value.data[1 +
+                        channel * per_channel + i]);
+                if (digit < 0) {
+                    return False;
+                }
+                component = (component << 4) | (uint32_t) digit;
+            }
+            /* Keep the 8 most significant bits; as in X, the digits
+             * are the most significant ones, not scaled ('#F' is F0) */
+            if (per_channel == 1) {
+                component <<= 4;
+            } else {
+                component >>= 4 * (per_channel - 2);
+            }
+            rgb = (rgb << 8) | component;
+        }
+        *argb = 0xFF000000u | rgb;
+        return True;
+    }
+
+    /* Names: case insensitive, spaces ignored */
+    for (size_t i = 0; i < value.length; ++i) {
+        char c = value.data[i];
+        if (_is_blank(c)) {
+            continue;
+        }
+        if (length + 1 >= sizeof(name)) {
+            return False;
+        }
+        name[length++] = (c >= 'A' && c <= 'Z') ? (char) (c - 'A' + 'a') : c;
+    }
+    name[length] = '\0';
+
+    if (strcmp(name, "none") == 0) {
+        *argb = PIXEL_TRANSPARENT;
+        return True;
+    }
+    if ((strncmp(name, "gray", 4) == 0 || strncmp(name, "grey", 4) == 0) &&
+            length > 4 && length <= 7) {
+        unsigned int level = 0;
+        for (size_t i = 4; i < length; ++i) {
+            if (!_is_digit(name[i])) {
+                return False;
+            }
+            level = level * 10 + (unsigned int) (name[i] - '0');
+        }
+        if (level > 100) {
+            return False;
+        }
+        uint32_t gray = (level * 255 + 49) / 100;   /* as X 'rgb.txt' */
+        *argb = 0xFF000000u | (gray << 16) | (gray << 8) | gray;
+        return True;
+    }
+    for (size_t i = 0; i < sizeof(_color_names) / sizeof(*_color_names);
+            ++i) {
+        if (strcmp(name, _color_names[i].name) == 0) {
+            *argb = 0xFF000000u | _color_names[i].rgb;
+            return True;
+        }
+    }
+
+    return False;
+}
+
+
+/* Get the next string literal, skipping comments and anything else */
+static Bool _xpm_string(const char **cursor, const char *end,
+        span_td *string)
+{
+    const char *p = *cursor;
+
+    while (p < end) {
+        if (*p == '"') {
+            const char *start = ++p;
+            while (p < end && *p != '"') {
+                p += (*p == '\\' && p + 1 < end) ? 2 : 1;
+            }
+            if (p >= end) {
+                return False;
+            }
+            string->data = start;
+            string->length = (size_t) (p - start);
+            *cursor = p + 1;
+            return True;
+        }
+        if (*p == '/' && p + 1 < end && p[1] == '*') {
+            for (p += 2; p + 1 < end && !(p[0] == '*' && p[1] == '/'); ++p);
+            if (p + 1 >= end) {
+                return False;
+            }
+            p += 2;
+        } else {
+            ++p;
+        }
+    }
+
+    return False;
+}
+
+
+/* Parse an XPM color line, after its key, into a pixel; the preferred
+ * visual is color, then grayscale, then monochrome */
+static Bool _xpm_color(span_td line, unsigned int cpp, uint32_t *argb)
+{
+    static const char *contexts[] = { "c", "g", "g4", "m", "s" };
+    span_td values[5] = { { NULL, 0 } };
+    span_td word;
+    int current = -1;
+
+    if (line.length < cpp) {
+        return False;
+    }
+    line.data += cpp;
+    line.length -= cpp;
+
+    /* Values can have several words, up to the next context key */
+    while (_span_word(&line, &word)) {
+        int context = -1;
+        for (int i = 0; i < 5; ++i) {
+            if (_span_is(word, contexts[i])) {
+                context = i;
+                break;
+            }
+        }
+        if (context >= 0 && (current < 0 || values[current].data)) {
+            current = context;
+            values[current].data = NULL;
+        } else if (current >= 0) {
+            if (!values[current].data) {
+                values[current].data = word.data;
+            }
+            values[current].length = (size_t) (word.data + word.length -
+                    values[current].data);
+        }
+    }
+
+    for (int i = 0; i < 4; ++i) {
+        if (values[i].data) {
+            return _color_parse(values[i], argb);
+        }
+    }
+
+    return False;
+}
+
+
+/* Hash (FNV-1a, 32 bits) of a color key */
+static inline uint32_t _key_hash(const char *key, unsigned int cpp)
+{
+    uint32_t hash = 0x811C9DC5u;
+    for (unsigned int i = 0; i < cpp; ++i) {
+        hash = (hash ^ (unsigned char) key[i]) * 0x01000193u;
+    }
+    return hash;
+}
+
+
+/* Decode XPM pixel rows whose keys index a direct table of pixels */
+static Bool _xpm_pixels_direct(const char **cursor, const char *end,
+        pixbuf_td *pixbuf, unsigned int cpp, const uint32_t *table)
+{
+    for (unsigned int y = 0; y < pixbuf->height; ++y) {
+        const unsigned char *p;
+        uint32_t *restrict dst = pixbuf->data +
+            (size_t) y * pixbuf->width;
+        uint32_t undefined = 0;
+        span_td row;
+
+        if (!_xpm_string(cursor, end, &row) ||
+                row.length < (size_t) pixbuf->width * cpp) {
+            return False;
+        }
+        p = (const unsigned char *) row.data;
+        if (cpp == 1) {
+            for (unsigned int x = 0; x < pixbuf->width; ++x) {
+                uint32_t pixel = table[p[x]];
+                undefined |= (pixel == PIXEL_UNDEFINED);
+                dst[x] = pixel;
+            }
+        } else {
+            for (unsigned int x = 0; x < pixbuf->width; ++x) {
+                uint32_t pixel = table[((unsigned int) p[2 * x] << 8) |
+                    p[2 * x + 1]];
+                undefined |= (pixel == PIXEL_UNDEFINED);
+                dst[x] = pixel;
+            }
+        }
+        if (undefined) {
+            return False;
+        }
+    }
+
+    return True;
+}
+
+
+/* Decode XPM pixel rows whose keys go through a hash table */
+static Bool _xpm_pixels_hashed(const char **cursor, const char *end,
+        pixbuf_td *pixbuf, unsigned int cpp, const char **keys,
+        const uint32_t *pixels, const uint32_t *slots, uint32_t mask)
+{
+    for (unsigned int y = 0; y < pixbuf->height; ++y) {
+        uint32_t *dst = pixbuf->data + (size_t) y * pixbuf->width;
+        const char *last_key = NULL;
+        uint32_t last_pixel = PIXEL_UNDEFINED;
+        span_td row;
+
+        if (!_xpm_string(cursor, end, &row) ||
+                row.length < (size_t) pixbuf->width * cpp) {
+            return False;
+        }
+        for (unsigned int x = 0; x < pixbuf->width; ++x) {
+            const char *key = row.data + (size_t) x * cpp;
+
+            /* Runs of a single color are the common case */
+            if (last_key && memcmp(key, last_key, cpp) == 0) {
+                dst[x] = last_pixel;
+                continue;
+            }
+            uint32_t slot = _key_hash(key, cpp) & mask;
+            while (slots[slot] &&
+                    memcmp(keys[slots[slot] - 1], key, cpp) != 0) {
+                slot = (slot + 1) & mask;
+            }
+            if (!slots[slot]) {
+                return False;
+            }
+            last_key = key;
+            last_pixel = pixels[slots[slot] - 1];
+            dst[x] = last_pixel;
+        }
+    }
+
+    return True;
+}
+
+
+/* Read an XPM (version 3) image from its mapped text */
+static pixbuf_td *_xpm_read(const char *cursor, const char *end)
+{
+    unsigned long width, height, colors, cpp;
+    pixbuf_td *pixbuf = NULL;
+    span_td header;
+    Bool decoded = False;
+
+    if (!_xpm_string(&cursor, end, &header) ||
+            !_span_number(&header, &width) ||
+            !_span_number(&header, &height) ||
+            !_span_number(&header, &colors) ||
+            !_span_number(&header, &cpp) ||
+            width == 0 || width > IMGFILE_MAX_SIDE ||
+            height == 0 || height > IMGFILE_MAX_SIDE ||
+            colors == 0 || colors > IMGFILE_MAX_COLORS ||
+            cpp == 0 || cpp > IMGFILE_MAX_CPP) {
+        return NULL;
+    }
+
+    if (cpp <= 2) {
+        /* Direct table, indexed by the key characters themselves */
+        uint32_t *table = calloc((size_t) 1 << (8 * cpp), sizeof(*table));
+        if (!table) {
+            return NULL;
+        }
+        for (unsigned long i = 0; i < colors; ++i) {
+            span_td line;
+            uint32_t pixel;
+            if (!_xpm_string(&cursor, end, &line) ||
+                    !_xpm_color(line, (unsigned int) cpp, &pixel)) {
+                free(table);
+                return NULL;
+            }
+            const unsigned char *key = (const unsigned char *) line.data;
+            table[(cpp == 1) ? key[0] :
+                ((unsigned int) key[0] << 8 | key[1])] = pixel;
+        }
+        pixbuf = pixbuf_new((unsigned int) width, (unsigned int) height);
+        decoded = pixbuf && _xpm_pixels_direct(&cursor, end, pixbuf,
+                (unsigned int) cpp, table);
+        free(table);
+    } else {
+        /* Open addressing hash table, at most half full */
+        uint32_t capacity = 2;
+        while (capacity < 2 * colors) {
+            capacity <<= 1;
+        }
+        const char **keys = malloc(colors * sizeof(*keys));
+        uint32_t *pixels = malloc(colors * sizeof(*pixels));
+        uint32_t *slots = calloc(capacity, sizeof(*slots));
+        Bool parsed = keys && pixels && slots;
+        for (unsigned long i = 0; parsed && i < colors; ++i) {
+            span_td line;
+            parsed = _xpm_string(&cursor, end, &line) &&
+                _xpm_color(line, (unsigned int) cpp, &pixels[i]);
+            if (parsed) {
+                keys[i] = line.data;
+                uint32_t slot = _key_hash(keys[i], (unsigned int) cpp) &
+                    (capacity - 1);
+                while (slots[slot] && memcmp(keys[slots[slot] - 1],
+                            keys[i], cpp) != 0) {
+                    slot = (slot + 1) & (capacity - 1);
+                }
+                if (!slots[slot]) {
+                    slots[slot] = (uint32_t) i + 1;
+                }
+            }
+        }
+        if (parsed) {
+            pixbuf = pixbuf_new((unsigned int) width, (unsigned int) height);
+            decoded = pixbuf && _xpm_pixels_hashed(&cursor, end, pixbuf,
+                    (unsigned int) cpp, keys, pixels, slots, capacity - 1);
+        }
+        free(keys);
+        free(pixels);
+        free(slots);
+    }
+
+    if (!decoded) {
+        pixbuf_destroy(pixbuf);
+        return NULL;
+    }
+
+    return pixbuf;
+}
+
+
+/* Whether a piece of text contains a word */
+static Bool _text_contains(const char *text, const char *end,
+        const char *word)
+{
+    size_t length = strlen(word);
+    for (; text + length <= end; ++text) {
+        if (memcmp(text, word, length) == 0) {
+            return True;
+        }
+    }
+    return False;
+}
+
+
+/* Read a number in C notation (decimal or hexadecimal) */
+static Bool _text_number(const char **cursor, const char *end,
+        unsigned long *value)
+{
+    const char *p = *cursor;
+    unsigned long base = 10;
+
+    if (p + 1 < end && p[0] == '0' && (p[1] == 'x' || p[1] == 'X')) {
+        base = 16;
+        p += 2;
+    }
+    *value = 0;
+    const char *start = p;
+    for (; p < end && _hex_value(*p) >= 0 &&
+            (base == 16 || _is_digit(*p)); ++p) {
+        if (*value > 0xFFFFFFul) {
+            return False;
+        }
+        *value = *value * base + (unsigned long) _hex_value(*p);
+    }
+    *cursor = p;
+
+    return p > start;
+}
+
+
+/* Row kernel: expand 1-bit pixels (least significant bit first, set for
+ * black) a 32-bit word at a time */
+static void _row_expand(const uint32_t *restrict bits,
+        uint32_t *restrict dst, unsigned int width)
+{
+    for (unsigned int word = 0; word * 32 < width; ++word) {
+        uint32_t value = bits[word];
+        unsigned int count = (width - word * 32 < 32) ?
+            width - word * 32 : 32;
+        uint32_t *restrict out = dst + word * 32;
+        for (unsigned int i = 0; i < count; ++i) {
+            uint32_t mask = 0u - ((value >> i) & 1u);
+            out[i] = PIXEL_WHITE ^ (mask & (PIXEL_WHITE ^ PIXEL_BLACK));
+        }
+    }
+}
+
+
+/* Read an XBM image from its mapped text */
+static pixbuf_td *_xbm_read(const char *cursor, const char *end)
+{
+    unsigned long width = 0, height = 0;
+    const char *declaration = cursor;
+
+    /* '#define <name>_width <n>' and '#define <name>_height <n>' */
+    const char *define;
+    while ((define = memchr(cursor, '#', (size_t) (end - cursor))) &&
+            (size_t) (end - define) >= 7 &&
+            memcmp(define, "#define", 7) == 0) {
+        const char *name;
+        size_t length;
+        unsigned long value;
+
+        for (cursor = define + 7; cursor < end && _is_blank(*cursor);
+                ++cursor);
+        for (name = cursor; cursor < end && !_is_blank(*cursor); ++cursor);
+        length = (size_t) (cursor - name);
+        for (; cursor < end && _is_blank(*cursor); ++cursor);
+        if (!_text_number(&cursor, end, &value)) {
+            return NULL;
+        }
+        if (length >= 6 && memcmp(name + length - 6, "_width", 6) == 0) {
+            width = value;
+        } else if (length >= 7 &&
+                memcmp(name + length - 7, "_height", 7) == 0) {
+            height = value;
+        }
+        declaration = cursor;
+    }
+    if (width == 0 || width > IMGFILE_MAX_SIDE ||
+            height == 0 || height > IMGFILE_MAX_SIDE) {
+        return NULL;
+    }
+
+    /* X10 bitmaps have 16 bits per value; X11 ones have 8 */
+    const char *values = memchr(declaration, '{',
+            (size_t) (end - declaration));
+    if (!values) {
+        return NULL;
+    }
+    unsigned int value_bits =
+        _text_contains(declaration, values, "short") ? 16 : 8;
+    unsigned int values_per_row = ((unsigned int) width + value_bits - 1) /
+        value_bits;
+    unsigned int words_per_row = ((unsigned int) width + 31) / 32;
+
+    pixbuf_td *pixbuf = pixbuf_new((unsigned int) width,
+            (unsigned int) height);
+    uint32_t *bits = malloc(words_per_row * sizeof(*bits));
+    if (!pixbuf || !bits) {
+        pixbuf_destroy(pixbuf);
+        free(bits);
+        return NULL;
+    }
+
+    cursor = values + 1;
+    for (unsigned int y = 0; y < pixbuf->height; ++y) {
+        memset(bits, 0, words_per_row * sizeof(*bits));
+        for (unsigned int i = 0; i < values_per_row; ++i) {
+            unsigned long value;
+            while (cursor < end && !_is_digit(*cursor) && *cursor != '}') {
+                ++cursor;
+            }
+            if (cursor >= end || *cursor == '}' ||
+                    !_text_number(&cursor, end, &value)) {
+                pixbuf_destroy(pixbuf);
+                free(bits);
+                return NULL;
+            }
+            unsigned int bit = i * value_bits;
+            bits[bit / 32] |= (uint32_t) (value &
+                    ((1ul << value_bits) - 1)) << (bit % 32);
+        }
+        _row_expand(bits, pixbuf->data + (size_t) y * pixbuf->width,
+                pixbuf->width);
+    }
+    free(bits);
+
+    return pixbuf;
+}
+
+
+/* Read an XPM (version 3) or XBM image file */
+pixbuf_td *imgfile_read(const char *path)
+{
+    pixbuf_td *pixbuf = NULL;
+    struct stat status;
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return NULL;
+    }
+    if (fstat(fd, &status) != 0 || status.st_size <= 0 ||
+            status.st_size > IMGFILE_MAX_FILE_SIZE) {
+        close(fd);
+        return NULL;
+    }
+
+    size_t size = (size_t) status.st_size;
+    const char *text = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (text == MAP_FAILED) {
+        return NULL;
+    }
+
+    const char *start = text;
+    const char *end = text + size;
+    while (start < end && (_is_blank(*start) || *start == '\n' ||
+                *start == '\r')) {
+        ++start;
+    }
+    if ((size_t) (end - start) >= 9 && memcmp(start, "/* XPM */", 9) == 0) {
+        pixbuf = _xpm_read(start, end);
+    } else if ((size_t) (end - start) >= 7 &&
+            memcmp(start, "#define", 7) == 0) {
+        pixbuf = _xbm_read(start, end);
+    }
+    munmap((void *) text, size);
+
+    return pixbuf;
+}
@@ -0,0 +1,328 @@
+/**
+ * @file live.c
+ *
+ * @brief Thumbnails that follow the changes of their window
+ *        implementation
+ */
+/*
+ * ISC License
+ * Copyright (c) 2025, J. A. Corbal <jacorbal@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS.  IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS
+ * ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF
+ * THIS SOFTWARE.
+ */
+
+/* Enable features from the POSIX.1-2008 standard */
+#define _POSIX_C_SOURCE 200809L
+
+/* Standard library includes */
+#include <stdint.h>     /* uint32_t */
+#include <stdlib.h>     /* calloc, free, malloc */
+#include <string.h>     /* memset */
+#include <time.h>       /* clock_gettime, timespec */
+
+/* X includes */
+#include <X11/Xlib.h>                   /* Display, Window, XImage, X* */
+#include <X11/Xutil.h>                  /* XDestroyImage */
+#include <X11/extensions/Xcomposite.h>  /* XComposite* */
+#include <X11/extensions/Xdamage.h>     /* XDamage* */
+
+/* Local includes */
+#include <live.h>
+#include <scale.h>
+
+
+/* Side of the tiles the thumbnail is split into (px) */
+#define LIVE_TILE_SIZE (8)
+
+
+/* Error handler that ignores errors; the window may be unmapped, and
+ * then it has no contents to capture */
+static int _error_ignore(Display *display, XErrorEvent *error)
+{
+    (void) display;
+    (void) error;
+    return 0;
+}
+
+
+/* Milliseconds elapsed since a given time */
+static long _elapsed(const struct timespec *since)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (long) (now.tv_sec - since->tv_sec) * 1000 +
+        (now.tv_nsec - since->tv_nsec) / 1000000;
+}
+
+
+/* Mark every tile of the thumbnail as damaged */
+static void _tiles_damage_all(live_td *live)
+{
+    memset(live->tiles, 1, (size_t) live->tiles_x * live->tiles_y);
+    live->damaged = live->tiles_x * live->tiles_y;
+}
+
+
+/* Mark the tiles covering a damaged area of the window */
+static void _tiles_damage(live_td *live, const XRectangle *area)
+{
+    unsigned int width = (unsigned int) live->thumbnail->width;
+    unsigned int height = (unsigned int) live->thumbnail->height;
+
+    if (area->width == 0 || area->height == 0 ||
+            live->src_width == 0 || live->src_height == 0) {
+        return;
+    }
+
+    /* Thumbnail pixels covering the area, one more on each side to
+     * account for the rounding of the box spans */
+    uint64_t x0 = (uint64_t) (area->x < 0 ? 0 : area->x) * width /
+        live->src_width;
+    uint64_t y0 = (uint64_t) (area->y < 0 ? 0 : area->y) * height /
+        live->src_height;
+    uint64_t x1 = ((uint64_t) (area->x < 0 ? 0 : area->x) + area->width) *
+        width / live->src_width + 2;
+    uint64_t y1 = ((uint64_t) (area->y < 0 ? 0 : area->y) + area->height) *
+        height / live->src_height + 2;
+    x0 = (x0 > 0) ? x0 - 1 : 0;
+    y0 = (y0 > 0) ? y0 - 1 : 0;
+    x1 = (x1 > width) ? width : x1;
+    y1 = (y1 > height) ? height : y1;
+
+    for (uint64_t ty = y0 / LIVE_TILE_SIZE;
+            ty * LIVE_TILE_SIZE < y1; ++ty) {
+        for (uint64_t tx = x0 / LIVE_TILE_SIZE;
+                tx * LIVE_TILE_SIZE < x1; ++tx) {
+            unsigned char *tile = &live->tiles[ty * live->tiles_x + tx];
+            live->damaged += !*tile;
+            *tile = 1;
+        }
+    }
+}
+
+
+/* Capture and reduce a rectangle of the thumbnail */
+static Bool _rect_refresh(live_td *live, Drawable drawable,
+        unsigned int x, unsigned int y,
+        unsigned int width, unsigned int height)
+{
+    XImage *thumbnail = live->thumbnail;
+    unsigned int src_x, src_y, src_width, src_height;
+
+    scale_box_span(live->src_width, (unsigned int) thumbnail->width,
+            x, width, &src_x, &src_width);
+    scale_box_span(live->src_height, (unsigned int) thumbnail->height,
+            y, height, &src_y, &src_height);
+
+    XImage *image = XGetImage(live->display, drawable,
+            (int) src_x, (int) src_y, src_width, src_height,
+            AllPlanes, ZPixmap);
+    if (!image) {
+        return False;
+    }
+
+    int rc = -1;
+    if (image->bits_per_pixel == 32 && image->bytes_per_line % 4 == 0) {
+        rc = scale_box_rect((const uint32_t *) (void *) image->data,
+                (size_t) image->bytes_per_line / 4,
+                live->src_width, live->src_height,
+                (uint32_t *) (void *) thumbnail->data,
+                (size_t) thumbnail->bytes_per_line / 4,
+                (unsigned int) thumbnail->width,
+                (unsigned int) thumbnail->height,
+                x, y, width, height);
+    }
+    XDestroyImage(image);
+
+    return rc == 0;
+}
+
+
+/* Whether the server can follow the changes of a window */
+Bool live_available(Display *display)
+{
+    int event_base, error_base;
+
+    return XCompositeQueryExtension(display, &event_base, &error_base) &&
+        XDamageQueryExtension(display, &event_base, &error_base);
+}
+
+
+/* Start following the changes of a window */
+live_td *live_start(Display *display, Window window, XImage *thumbnail,
+        unsigned int src_width, unsigned int src_height,
+        unsigned int rate)
+{
+    int event_base, error_base;
+
+    if (rate == 0 || thumbnail->bits_per_pixel != 32 ||
+            thumbnail->bytes_per_line % 4 != 0 ||
+            !XCompositeQueryExtension(display, &event_base, &error_base) ||
+            !XDamageQueryExtension(display, &event_base, &error_base)) {
+        return NULL;
+    }
+
+    live_td *live = malloc(sizeof(live_td));
+    if (!live) {
+        return NULL;
+    }
+    live->tiles_x = ((unsigned int) thumbnail->width + LIVE_TILE_SIZE - 1) /
+        LIVE_TILE_SIZE;
+    live->tiles_y = ((unsigned int) thumbnail->height + LIVE_TILE_SIZE - 1)
+        / LIVE_TILE_SIZE;
+    live->tiles = calloc((size_t) live->tiles_x * live->tiles_y, 1);
+    if (!live->tiles) {
+        free(live);
+        return NULL;
+    }
+
+    live->display = display;
+    live->window = window;
+    live->event_base = event_base;
+    live->src_width = src_width;
+    live->src_height = src_height;
+    live->thumbnail = thumbnail;
+    live->damaged = 0;
+    live->interval = 1000 / (long) rate;
+    clock_gettime(CLOCK_MONOTONIC, &live->last);
+
+    /* Keep the contents off-screen, as the window is out of sight, and
+     * be told about every area that grows the damage */
+    XCompositeRedirectWindow(display, window, CompositeRedirectAutomatic);
+    live->damage = XDamageCreate(display, window,
+            XDamageReportDeltaRectangles);
+
+    return live;
+}
+
+
+/* Stop following a window, and release the thumbnail */
+void live_stop(live_td *live, Bool destroyed)
+{
+    if (live) {
+        if (!destroyed) {
+            XDamageDestroy(live->display, live->damage);
+            XCompositeUnredirectWindow(live->display, live->window,
+                    CompositeRedirectAutomatic);
+        }
+        XDestroyImage(live->thumbnail);
+        free(live->tiles);
+        free(live);
+    }
+}
+
+
+/* Take the damage reported by an event */
+Bool live_event(live_td *live, const XEvent *event)
+{
+    const XDamageNotifyEvent *notify = (const XDamageNotifyEvent *) event;
+
+    if (event->type != live->event_base + XDamageNotify ||
+            notify->damage != live->damage) {
+        return False;
+    }
+
+    /* A resized window changes every box: reduce it whole again */
+    if (notify->geometry.width != live->src_width ||
+            notify->geometry.height != live->src_height) {
+        live->src_width = notify->geometry.width;
+        live->src_height = notify->geometry.height;
+        _tiles_damage_all(live);
+    } else {
+        _tiles_damage(live, &notify->area);
+    }
+
+    return True;
+}
+
+
+/* Time until the next refresh is due */
+int live_timeout(const live_td *live)
+{
+    if (live->damaged == 0) {
+        return -1;
+    }
+
+    long remaining = live->interval - _elapsed(&live->last);
+    return (remaining > 0) ? (int) remaining : 0;
+}
+
+
+/* Capture and reduce the damaged tiles again, if due */
+Bool live_refresh(live_td *live, XRectangle *changed)
+{
+    unsigned int width = (unsigned int) live->thumbnail->width;
+    unsigned int height = (unsigned int) live->thumbnail->height;
+    unsigned int x0 = width, y0 = height, x1 = 0, y1 = 0;
+
+    if (live_timeout(live) != 0) {
+        return False;
+    }
+
+    /* Damage after this point will be reported again */
+    XDamageSubtract(live->display, live->damage, None, None);
+
+    int (*handler)(Display *, XErrorEvent *) =
+        XSetErrorHandler(_error_ignore);
+    Pixmap pixmap = XCompositeNameWindowPixmap(live->display,
+            live->window);
+
+    /* A single capture for every run of damaged tiles in a row */
+    for (unsigned int ty = 0; ty < live->tiles_y; ++ty) {
+        const unsigned char *row = live->tiles + ty * live->tiles_x;
+        for (unsigned int tx = 0; tx < live->tiles_x; ) {
+            if (!row[tx]) {
+                ++tx;
+                continue;
+            }
+            unsigned int run = tx;
+            while (tx < live->tiles_x && row[tx]) {
+                ++tx;
+            }
+            unsigned int x = run * LIVE_TILE_SIZE;
+            unsigned int y = ty * LIVE_TILE_SIZE;
+            unsigned int w = ((tx * LIVE_TILE_SIZE < width) ?
+                    tx * LIVE_TILE_SIZE : width) - x;
+            unsigned int h = ((y + LIVE_TILE_SIZE < height) ?
+                    y + LIVE_TILE_SIZE : height) - y;
+            if (_rect_refresh(live, pixmap, x, y, w, h)) {
+                x0 = (x < x0) ? x : x0;
+                y0 = (y < y0) ? y : y0;
+                x1 = (x + w > x1) ? x + w : x1;
+                y1 = (y + h > y1) ? y + h : y1;
+            }
+        }
+    }
+
+    XFreePixmap(live->display, pixmap);
+    XSync(live->display, False);
+    XSetErrorHandler(handler);
+
+    /* Tiles that could not be captured (the window is not viewable) are
+     * damaged again when the window draws them */
+    memset(live->tiles, 0, (size_t) live->tiles_x * live->tiles_y);
+    live->damaged = 0;
+    clock_gettime(CLOCK_MONOTONIC, &live->last);
+
+    if (x1 <= x0 || y1 <= y0) {
+        return False;
+    }
+    changed->x = (short) x0;
+    changed->y = (short) y0;
+    changed->width = (unsigned short) (x1 - x0);
+    changed->height = (unsigned short) (y1 - y0);
+
+    return True;
+}
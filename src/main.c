@@ -34,18 +34,31 @@
  * THIS SOFTWARE.
  */
 
+/* Enable features from the X/Open 7 standard, as 'realpath' */
+#define _XOPEN_SOURCE 700
+
 /* Standard library includes */
 #include <getopt.h>     /* getopt, optarg, optind */
 #include <locale.h>     /* setlocale */
+#include <signal.h>     /* SIGUSR1 */
 #include <stdio.h>      /* fprintf, sscanf */
-#include <stdlib.h>     /* atoi, exit */
+#include <stdlib.h>     /* atoi, exit, free, realpath */
+#include <string.h>     /* memset, strcmp, strlen, strrchr */
 
 /* X includes */
 #include <X11/Xlib.h>   /* Bool, False, True, Display, Pixmap, Window, X* */
 
 /* Local includes */
+#include <compose.h>
+#include <daemon.h>
 #include <defaults.h>
 #include <iconify.h>
+#include <pixbuf.h>
+#include <pyramid.h>
+#include <render.h>
+#include <scale.h>
+#include <trace.h>
+#include <upload.h>
 
 
 /* Convert hexadecimal color string into unsigned long */
@@ -57,14 +70,57 @@ static unsigned long _hex_to_ulong(const char *color_str)
 }
 
 
+/* Render an icon to a file, without an X server */
+static int _render_file(icon_td *icon, const char *output)
+{
+    pyramid_td *pyramid = pyramid_load(icon->path);
+    if (!pyramid) {
+        fprintf(stderr, "Error: could not read icon '%s'\n", icon->path);
+        return -1;
+    }
+
+    /* Composed from the closest larger size of the icon */
+    pixbuf_td *pixbuf = compose_icon(icon,
+            pyramid_level(pyramid, icon->width, icon->height));
+    pyramid_destroy(pyramid);
+    if (!pixbuf) {
+        fprintf(stderr, "Error: could not render icon\n");
+        return -1;
+    }
+
+    int rc = compose_write(pixbuf, output);
+    pixbuf_destroy(pixbuf);
+
+    return rc;
+}
+
+
 /* Show help */
 void _help_show(FILE *fp, const char basename[])
 {
-    fprintf(fp, "Usage: %s [<options>] <window_id>\n", basename);
+    fprintf(fp, "Usage: %s [<options>] <window_id>...\n", basename);
+    fprintf(fp, "       %s [<options>] -C <class> [-g <group>]\n",
+            basename);
+    fprintf(fp, "       %s -R [-C <class>] [-g <group>] [<window_id>...]\n",
+            basename);
+    fprintf(fp, "       %s -d\n", basename);
+    fprintf(fp, "       %s -P\n", basename);
+    fprintf(fp, "       %s -o <file> [<options>]\n", basename);
     fprintf(fp, "Options:\n");
     fprintf(fp, "   -h          This help\n");
+    fprintf(fp, "   -d          Run as daemon, managing every icon\n");
+    fprintf(fp, "   -c          Send the window to the daemon, if any\n");
+    fprintf(fp, "   -P          Let the daemon place every icon again\n");
+    fprintf(fp, "   -R          Let the daemon restore the windows chosen\n");
+    fprintf(fp, "   -C <class>  Choose the windows of a class (daemon)\n");
+    fprintf(fp, "   -g <group>  Add the icons to a group, or choose it\n");
+    fprintf(fp, "   -o <file>   Render the icon to a PPM/PAM file, no X\n");
     fprintf(fp, "   -t          Disable text caption\n");
+    fprintf(fp, "   -S          Show a snapshot of the window as icon\n");
+    fprintf(fp, "   -L <rate>   Live snapshot, refreshed up to <rate>/s\n");
+    fprintf(fp, "   -T          Print X requests and times at exit\n");
     fprintf(fp, "   -n <name>   Name to show below the icon\n");
+    fprintf(fp, "   -p <x>,<y>  Icon position, or the nearest free one\n");
     fprintf(fp, "   -i <icon>   Path to the icon pixmap (xpm/xbm)\n");
     fprintf(fp, "   -W <width>  Icon width in pixels\n");
     fprintf(fp, "   -H <height> Icon height in pixels\n");
@@ -73,6 +129,7 @@ void _help_show(FILE *fp, const char basename[])
     fprintf(fp, "   -F <fg>     Text foreground color\n");
     fprintf(fp, "   -f <fc>     Frame color when border is active\n");
     fprintf(fp, "   -b <border> Border width in pixels, o 0 for none\n");
+    fprintf(fp, "   -r <filter> Scaling filter (nearest, bilinear, box)\n");
     fprintf(fp, "\n");
 }
 
@@ -90,15 +147,64 @@ int main(int argc, char *argv[])
     unsigned long fg = DEFAULT_TEXT_FG;
     unsigned long fc = DEFAULT_TEXT_FC;
     Bool show_text = True;
+    Bool snapshot = False;
+    unsigned int live_rate = 0;
+    scale_filter_td filter = DEFAULT_SCALE_FILTER;
+    Bool run_daemon = False;
+    Bool use_daemon = False;
+    Bool repack = False;
+    Bool restore = False;
+    const char *res_class = NULL;
+    const char *group = NULL;
+    Bool anchor = False;
+    int x_anchor = 0;
+    int y_anchor = 0;
+#ifdef DEBUG
+    Bool trace = True;      /* Debug builds always print the totals */
+#else
+    Bool trace = False;
+#endif
+    const char *output = NULL;
+    char socket_path[MAX_PATH_LENGTH];
     int opt;
 
     setlocale(LC_ALL, "");
-    while ((opt = getopt(argc, argv, "hn:W:H:i:s:F:B:f:b:t")) != -1) {
+    while ((opt = getopt(argc, argv,
+                    "hdcPRC:g:o:n:p:W:H:i:s:F:B:f:b:r:tSL:T")) != -1) {
         switch (opt) {
             case 'h':
                 _help_show(stdout, argv[0]);
                 exit(EXIT_SUCCESS);
                 break;
+            case 'd':
+                run_daemon = True;
+                break;
+            case 'c':
+                use_daemon = True;
+                break;
+            case 'P':
+                repack = True;
+                break;
+            case 'R':
+                restore = True;
+                break;
+            case 'C':
+                res_class = optarg;
+                break;
+            case 'g':
+                group = optarg;
+                break;
+            case 'p':
+                if (sscanf(optarg, "%d,%d", &x_anchor, &y_anchor) != 2) {
+                    fprintf(stderr, "Error: position '%s' is not <x>,<y>\n",
+                            optarg);
+                    exit(EXIT_FAILURE);
+                }
+                anchor = True;
+                break;
+            case 'o':
+                output = optarg;
+                break;
             case 'n':
                 prog_name = optarg;
                 break;
@@ -127,47 +233,227 @@ int main(int argc, char *argv[])
             case 'b':
                 border = atoi(optarg);
                 break;
+            case 'r':
+                if (!scale_filter_parse(optarg, &filter)) {
+                    fprintf(stderr, "Error: unknown filter '%s'\n", optarg);
+                    exit(EXIT_FAILURE);
+                }
+                break;
             case 't':
                 show_text = False;
                 break;
+            case 'S':
+                snapshot = True;
+                break;
+            case 'L':
+                snapshot = True;
+                live_rate = (atoi(optarg) > 0) ?
+                    (unsigned int) atoi(optarg) : DEFAULT_LIVE_RATE;
+                break;
+            case 'T':
+                trace = True;
+                break;
             default:
                 _help_show(stderr, argv[0]);
                 exit(EXIT_FAILURE);
         }
     }
 
-    if (optind >= argc) {
+    /* Render mode: the icon as it would be shown, but in a file */
+    if (output) {
+        icon_td render;
+        memset(&render, 0, sizeof(render));
+        const char *slash = strrchr(path, '/');
+        render.prog_name = (char *) ((prog_name) ? prog_name :
+                (slash) ? slash + 1 : path);
+        render.path = (char *) path;
+        render.border = (unsigned int) border;
+        render.width = (unsigned int) width;
+        render.height = (unsigned int) height;
+        render.bg = bg;
+        render.fg = fg;
+        render.fc = fc;
+        render.show_text = show_text;
+        render.filter = filter;
+        exit((_render_file(&render, output) == 0) ?
+                EXIT_SUCCESS : EXIT_FAILURE);
+    }
+
+    if ((run_daemon || use_daemon || repack || restore || res_class ||
+                group || argc - optind > 1) &&
+            !daemon_socket_path(socket_path, sizeof(socket_path))) {
+        fprintf(stderr, "Error: daemon socket path is too long\n");
+        exit(EXIT_FAILURE);
+    }
+
+    /* Totals are dumped as JSON on demand, for long-lived icons */
+    trace_dump_install(SIGUSR1);
+
+    /* Daemon mode: every icon in this process, until interrupted */
+    if (run_daemon) {
+        XInitThreads();     /* Any request may ask for a snapshot */
+        Display *display = XOpenDisplay(NULL);
+        if (!display) {
+            fprintf(stderr, "Error: could not open display\n");
+            exit(EXIT_FAILURE);
+        }
+        int rc = daemon_run(display, socket_path);
+        if (trace) {
+            trace_print(stderr);
+        }
+        upload_release(display);
+        render_release(display);
+        XCloseDisplay(display);
+        exit((rc == 0) ? EXIT_SUCCESS : EXIT_FAILURE);
+    }
+
+    /* Re-pack mode: only the daemon knows every icon */
+    if (repack) {
+        request_td request;
+        memset(&request, 0, sizeof(request));
+        request.type = REQUEST_REPACK;
+        switch (daemon_send(socket_path, &request)) {
+            case 0:
+                exit(EXIT_SUCCESS);
+            case 1:
+                fprintf(stderr, "Error: daemon could not place the icons\n");
+                break;
+            default:
+                fprintf(stderr, "Error: no daemon is running\n");
+                break;
+        }
+        exit(EXIT_FAILURE);
+    }
+
+    /* Every window given, for the daemon to take them in one batch */
+    request_td request;
+    memset(&request, 0, sizeof(request));
+    for (int i = optind; i < argc; ++i) {
+        Window window = (Window) strtoul(argv[i], NULL, 0);
+        if (window == 0) {
+            fprintf(stderr, "Error: window ID '%s' is not valid\n", argv[i]);
+            exit(EXIT_FAILURE);
+        }
+        if (request.count == REQUEST_WINDOWS_MAX) {
+            fprintf(stderr, "Error: no more than %d windows at once\n",
+                    REQUEST_WINDOWS_MAX);
+            exit(EXIT_FAILURE);
+        }
+        request.windows[request.count++] = window;
+    }
+    snprintf(request.res_class, sizeof(request.res_class), "%s",
+            (res_class) ? res_class : "");
+    snprintf(request.group, sizeof(request.group), "%s",
+            (group) ? group : "");
+
+    /* Nothing chosen: a class or a group chooses windows by itself,
+     * but a group is only known to the daemon when restoring */
+    if (request.count == 0 && !res_class && !(restore && group)) {
         _help_show(stderr, argv[0]);
         exit(EXIT_FAILURE);
     }
-    
-    Window window_orig = (Window) strtoul(argv[optind], NULL, 0);
-    if (window_orig == 0) {
-        fprintf(stderr, "Error: original window ID is not valid\n");
+
+    /* Restore mode: only the daemon knows which icons are chosen */
+    if (restore) {
+        request.type = REQUEST_RESTORE;
+        switch (daemon_send(socket_path, &request)) {
+            case 0:
+                exit(EXIT_SUCCESS);
+            case 1:
+                fprintf(stderr, "Error: daemon has no such icon\n");
+                break;
+            default:
+                fprintf(stderr, "Error: no daemon is running\n");
+                break;
+        }
         exit(EXIT_FAILURE);
     }
+
+    /* Client mode: let the daemon iconify them, if there is one running;
+     * a batch, a class or a group can only be iconified by the daemon */
+    Bool batch = (request.count > 1 || res_class || group);
+    if (use_daemon || batch) {
+        request.type = REQUEST_ICONIFY;
+        snprintf(request.name, sizeof(request.name), "%s",
+                (prog_name) ? prog_name : "");
+
+        /* The daemon runs elsewhere: a relative path is resolved here,
+         * and a path that does not fit is not cut */
+        char *resolved = NULL;
+        if (strcmp(path, DEFAULT_ICON_PATH) != 0 &&
+                !(resolved = realpath(path, NULL))) {
+            fprintf(stderr, "Error: could not find icon '%s'\n", path);
+            exit(EXIT_FAILURE);
+        }
+        if (strlen((resolved) ? resolved : path) >= sizeof(request.path)) {
+            fprintf(stderr, "Error: icon path '%s' is too long\n", path);
+            exit(EXIT_FAILURE);
+        }
+        snprintf(request.path, sizeof(request.path), "%s",
+                (resolved) ? resolved : path);
+        free(resolved);
+        request.border = (unsigned int) border;
+        request.width = (unsigned int) width;
+        request.height = (unsigned int) height;
+        request.bg = bg;
+        request.fg = fg;
+        request.fc = fc;
+        request.show_text = show_text;
+        request.filter = (int) filter;
+        request.snapshot = snapshot;
+        request.live_rate = live_rate;
+        request.anchor = anchor;
+        request.x_anchor = x_anchor;
+        request.y_anchor = y_anchor;
+
+        switch (daemon_send(socket_path, &request)) {
+            case 0:
+                exit(EXIT_SUCCESS);
+            case 1:
+                fprintf(stderr, "Error: daemon could not iconify %s\n",
+                        (batch) ? "every window" : "window");
+                exit(EXIT_FAILURE);
+            default:
+                if (batch) {
+                    fprintf(stderr, "Error: no daemon is running\n");
+                    exit(EXIT_FAILURE);
+                }
+                break;  /* No daemon: iconify it in this process */
+        }
+    }
+    Window window_orig = (Window) request.windows[0];
     
+    /* Snapshots are reduced on a thread that notifies through Xlib */
+    if (snapshot) {
+        XInitThreads();
+    }
     Display *display = XOpenDisplay(NULL);
     if (!display) {
         fprintf(stderr, "Error: could not open display\n");
         exit(EXIT_FAILURE);
     }
 
-    Pixmap pixmap = icon_load(display, path, window_orig);
-    if (pixmap == None) {
-        fprintf(stderr, "Error: could not load icon\n");
-        XCloseDisplay(display);
-        exit(EXIT_FAILURE);
-    }
-
     // Inicializar el icono
-    icon = icon_init(display, window_orig, pixmap, prog_name, path,
+    icon = icon_init(display, window_orig, prog_name, path,
             (unsigned int) border,
             (unsigned int) width, (unsigned int) height,
             bg, fg, fc, show_text);
     if (!icon) {
         fprintf(stderr, "Error: could not initialize icon\n");
-        XFreePixmap(display, pixmap);
+        XCloseDisplay(display);
+        exit(EXIT_FAILURE);
+    }
+    icon->filter = filter;
+    icon->snapshot = snapshot;
+    icon->live_rate = live_rate;
+    if (anchor) {
+        icon->x_pos = x_anchor;
+        icon->y_pos = y_anchor;
+    }
+
+    if (icon_load(icon) == None) {
+        fprintf(stderr, "Error: could not load icon\n");
+        icon_destroy(icon);
         XCloseDisplay(display);
         exit(EXIT_FAILURE);
     }
@@ -176,6 +462,12 @@ int main(int argc, char *argv[])
     events_handle(icon);
     icon_destroy(icon);
 
+    if (trace) {
+        trace_print(stderr);
+        upload_stats_print(stderr);
+    }
+    upload_release(display);
+    render_release(display);
     XCloseDisplay(display);
 
     return 0;
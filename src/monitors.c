@@ -0,0 +1,195 @@
+/**
+ * @file monitors.c
+ *
+ * @brief Geometry of the monitors, as RandR reports it implementation
+ */
+/*
+ * ISC License
+ * Copyright (c) 2025, J. A. Corbal <jacorbal@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS.  IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS
+ * ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF
+ * THIS SOFTWARE.
+ */
+
+/* X includes */
+#include <X11/Xlib.h>                   /* Bool, Display, XEvent, X* */
+#include <X11/extensions/Xrandr.h>      /* XRR*, RR* */
+
+/* Local includes */
+#include <monitors.h>
+
+
+/* Add the area of a monitor, unless there is no room left */
+static void _monitor_add(monitors_td *monitors, int x, int y,
+        unsigned int width, unsigned int height)
+{
+    if (monitors->count < MONITORS_MAX && width > 0 && height > 0) {
+        XRectangle *area = &monitors->areas[monitors->count++];
+        area->x = (short) x;
+        area->y = (short) y;
+        area->width = (unsigned short) width;
+        area->height = (unsigned short) height;
+    }
+}
+
+
+/* Add the area of every active CRTC, for RandR 1.2 to 1.4; a CRTC
+ * shown on several outputs (clone mode) counts once */
+static void _crtcs_add(monitors_td *monitors, Display *display)
+{
+    XRRScreenResources *resources = XRRGetScreenResourcesCurrent(display,
+            DefaultRootWindow(display));
+    if (!resources) {
+        return;
+    }
+    for (int i = 0; i < resources->ncrtc; ++i) {
+        XRRCrtcInfo *crtc = XRRGetCrtcInfo(display, resources,
+                resources->crtcs[i]);
+        if (crtc && crtc->mode != None && crtc->noutput > 0) {
+            _monitor_add(monitors, crtc->x, crtc->y,
+                    crtc->width, crtc->height);
+        }
+        if (crtc) {
+            XRRFreeCrtcInfo(crtc);
+        }
+    }
+    XRRFreeScreenResources(resources);
+}
+
+
+/* Query the monitors of the default screen */
+static void _monitors_query(monitors_td *monitors, Display *display)
+{
+    int screen = DefaultScreen(display);
+
+    monitors->count = 0;
+    monitors->width = (unsigned int) DisplayWidth(display, screen);
+    monitors->height = (unsigned int) DisplayHeight(display, screen);
+    if (monitors->monitor_list) {
+        int count = 0;
+        XRRMonitorInfo *list = XRRGetMonitors(display,
+                DefaultRootWindow(display), True/*active*/, &count);
+        for (int i = 0; list && i < count; ++i) {
+            _monitor_add(monitors, list[i].x, list[i].y,
+                    (unsigned int) list[i].width,
+                    (unsigned int) list[i].height);
+        }
+        if (list) {
+            XRRFreeMonitors(list);
+        }
+    } else if (monitors->event_base >= 0) {
+        _crtcs_add(monitors, display);
+    }
+
+    /* Without RandR, or without any output on: the whole screen */
+    if (monitors->count == 0) {
+        _monitor_add(monitors, 0, 0, monitors->width, monitors->height);
+    }
+    monitors->stale = False;
+}
+
+
+/* Query the monitors, and ask to be notified of their changes */
+void monitors_init(monitors_td *monitors, Display *display)
+{
+    int event_base, error_base;
+    int major = 0, minor = 0;
+
+    monitors->event_base = -1;
+    monitors->monitor_list = False;
+    if (XRRQueryExtension(display, &event_base, &error_base) &&
+            XRRQueryVersion(display, &major, &minor) &&
+            (major > 1 || (major == 1 && minor >= 2))) {
+        monitors->event_base = event_base;
+        monitors->monitor_list = (major > 1 || minor >= 5);
+        XRRSelectInput(display, DefaultRootWindow(display),
+                RRScreenChangeNotifyMask);
+    }
+    _monitors_query(monitors, display);
+}
+
+
+/* Take a RandR notification, if the event is one */
+Bool monitors_event(monitors_td *monitors, XEvent *event)
+{
+    if (monitors->event_base < 0 ||
+            event->type != monitors->event_base + RRScreenChangeNotify) {
+        return False;
+    }
+
+    /* Let Xlib know the new size of the screen */
+    XRRUpdateConfiguration(event);
+    monitors->stale = True;
+
+    return True;
+}
+
+
+/* Query the monitors again, if the screen has changed */
+Bool monitors_update(monitors_td *monitors, Display *display)
+{
+    if (!monitors->stale) {
+        return False;
+    }
+    _monitors_query(monitors, display);
+
+    return True;
+}
+
+
+/* Distance (squared) from a point to an area; 0 if it is in it */
+static long long _distance(const XRectangle *area, int x, int y)
+{
+    long long dx = (x < area->x) ? area->x - x :
+        (x >= area->x + area->width) ? x - (area->x + area->width - 1) : 0;
+    long long dy = (y < area->y) ? area->y - y :
+        (y >= area->y + area->height) ? y - (area->y + area->height - 1) :
+        0;
+
+    return dx * dx + dy * dy;
+}
+
+
+/* Get the monitor of a point */
+const XRectangle *monitors_find(const monitors_td *monitors, int x, int y)
+{
+    const XRectangle *nearest = &monitors->areas[0];
+    long long best = _distance(nearest, x, y);
+
+    for (unsigned int i = 1; i < monitors->count && best > 0; ++i) {
+        long long distance = _distance(&monitors->areas[i], x, y);
+        if (distance < best) {
+            best = distance;
+            nearest = &monitors->areas[i];
+        }
+    }
+
+    return nearest;
+}
+
+
+/* Whether an area is seen on any monitor */
+Bool monitors_visible(const monitors_td *monitors, const XRectangle *area)
+{
+    for (unsigned int i = 0; i < monitors->count; ++i) {
+        const XRectangle *monitor = &monitors->areas[i];
+        if (area->x < monitor->x + monitor->width &&
+                monitor->x < area->x + area->width &&
+                area->y < monitor->y + monitor->height &&
+                monitor->y < area->y + area->height) {
+            return True;
+        }
+    }
+
+    return False;
+}
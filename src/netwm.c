@@ -0,0 +1,196 @@
+/**
+ * @file netwm.c
+ *
+ * @brief Icons published by the clients in '_NET_WM_ICON'
+ *
+ * The property is an array of 32-bit values holding one or more icons,
+ * each one as its width, its height and then its non-premultiplied
+ * ARGB pixels, row after row.
+ */
+/*
+ * ISC License
+ * Copyright (c) 2025, J. A. Corbal <jacorbal@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS.  IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS
+ * ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF
+ * THIS SOFTWARE.
+ */
+
+/* Standard library includes */
+#include <stddef.h>     /* size_t */
+#include <stdint.h>     /* uint32_t */
+#include <stdlib.h>     /* free, malloc */
+#include <string.h>     /* memcpy */
+
+/* X includes */
+#include <X11/Xlib.h>   /* Atom, Display, Window, XGetWindowProperty */
+
+/* To avoid including <X11/Xatom.h> just for 'XA_CARDINAL', 'XA_WINDOW' */
+#ifndef XA_CARDINAL
+#define XA_CARDINAL ((Atom) 6)
+#endif
+#ifndef XA_WINDOW
+#define XA_WINDOW ((Atom) 33)
+#endif
+
+/* Local includes */
+#include <atoms.h>
+#include <defaults.h>
+#include <netwm.h>
+#include <pixbuf.h>
+
+
+/* Row kernel: narrow the property values to 32 bits; Xlib returns
+ * 32-bit properties as 'long', whatever its size */
+static void _row_narrow(const unsigned long *restrict src,
+        uint32_t *restrict dst, size_t length)
+{
+    for (size_t i = 0; i < length; ++i) {
+        dst[i] = (uint32_t) src[i];
+    }
+}
+
+
+/* Read the '_NET_WM_ICON' property of a window */
+uint32_t *netwm_icon_read(Display *display, Window window, size_t *length)
+{
+    Atom type;
+    int format;
+    unsigned long count;
+    unsigned long bytes_after;
+    unsigned char *data = NULL;
+    uint32_t *values = NULL;
+
+    *length = 0;
+    if (XGetWindowProperty(display, window,
+                atoms_get(display)[ATOM_NET_WM_ICON], 0,
+                MAX_NETWM_ICON_LENGTH, False, XA_CARDINAL, &type, &format,
+                &count, &bytes_after, &data) != Success || !data) {
+        return NULL;
+    }
+    if (format == 32 && count > 0 &&
+            (values = malloc(count * sizeof(*values))) != NULL) {
+        _row_narrow((const unsigned long *) (void *) data, values,
+                (size_t) count);
+        *length = (size_t) count;
+    }
+    XFree(data);
+
+    return values;
+}
+
+
+/* Pick the icon that best fits a size among the values of the property */
+pixbuf_td *netwm_icon_choose(const uint32_t *values, size_t length,
+        unsigned int width, unsigned int height)
+{
+    const uint32_t *best = NULL;
+    unsigned long best_width = 0;
+    unsigned long best_height = 0;
+
+    /* Walk every complete icon; a truncated last one is ignored */
+    for (size_t i = 0; values && i + 2 <= length; ) {
+        unsigned long w = values[i];
+        unsigned long h = values[i + 1];
+        if (w == 0 || h == 0 || w > 0xFFFF || h > 0xFFFF ||
+                w * h > length - i - 2) {
+            break;
+        }
+
+        Bool fits = (w >= width && h >= height);
+        Bool best_fits = (best_width >= width && best_height >= height);
+        if (!best ||
+                (fits && (!best_fits || w * h < best_width * best_height)) ||
+                (!fits && !best_fits && w * h > best_width * best_height)) {
+            best = values + i + 2;
+            best_width = w;
+            best_height = h;
+        }
+        i += 2 + w * h;
+    }
+
+    pixbuf_td *pixbuf = NULL;
+    if (best) {
+        pixbuf = pixbuf_new((unsigned int) best_width,
+                (unsigned int) best_height);
+        if (pixbuf) {
+            memcpy(pixbuf->data, best,
+                    (size_t) best_width * best_height * sizeof(*best));
+        }
+    }
+
+    return pixbuf;
+}
+
+
+/* Get the icon of a window that best fits a size */
+pixbuf_td *netwm_icon_get(Display *display, Window window,
+        unsigned int width, unsigned int height)
+{
+    size_t length;
+    uint32_t *values = netwm_icon_read(display, window, &length);
+    pixbuf_td *pixbuf = netwm_icon_choose(values, length, width, height);
+    free(values);
+
+    return pixbuf;
+}
+
+
+/* Get the client windows managed by the window manager */
+unsigned int netwm_clients_get(Display *display, Window **clients)
+{
+    Window root = DefaultRootWindow(display);
+    Atom type;
+    int format;
+    unsigned long length = 0;
+    unsigned long bytes_after;
+    unsigned char *data = NULL;
+    unsigned int count = 0;
+
+    *clients = NULL;
+    if (XGetWindowProperty(display, root,
+                atoms_get(display)[ATOM_NET_CLIENT_LIST], 0,
+                MAX_CLIENTS_LENGTH, False, XA_WINDOW, &type, &format,
+                &length, &bytes_after, &data) == Success && data &&
+            format == 32 && length > 0) {
+        /* Xlib returns 32-bit properties as 'long', and 'Window' is
+         * 'long' too */
+        *clients = malloc(length * sizeof(**clients));
+        if (*clients) {
+            memcpy(*clients, data, length * sizeof(**clients));
+            count = (unsigned int) length;
+        }
+        XFree(data);
+        return count;
+    }
+    if (data) {
+        XFree(data);
+    }
+
+    /* No window manager, or an old one: the top-level windows */
+    Window root_return, parent;
+    Window *children = NULL;
+    unsigned int n = 0;
+    if (XQueryTree(display, root, &root_return, &parent, &children, &n) &&
+            children && n > 0) {
+        *clients = malloc(n * sizeof(**clients));
+        if (*clients) {
+            memcpy(*clients, children, n * sizeof(**clients));
+            count = n;
+        }
+    }
+    if (children) {
+        XFree(children);
+    }
+
+    return count;
+}
@@ -0,0 +1,283 @@
+/**
+ * @file pixbuf.c
+ *
+ * @brief Client-side ARGB pixel buffers implementation
+ */
+/*
+ * ISC License
+ * Copyright (c) 2025, J. A. Corbal <jacorbal@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS.  IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS
+ * ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF
+ * THIS SOFTWARE.
+ */
+
+/* Standard library includes */
+#include <stdint.h>     /* uint32_t */
+#include <stdlib.h>     /* free, malloc */
+
+/* X includes */
+#include <X11/Xlib.h>   /* Display, Pixmap, Visual, XImage, X* */
+#include <X11/Xutil.h>  /* XDestroyImage, XPutPixel */
+
+/* Local includes */
+#include <pixbuf.h>
+#include <scale.h>
+#include <upload.h>
+
+
+/* Byte order of this machine, as X names it */
+static int _host_byte_order(void)
+{
+    const unsigned int one = 1;
+    return (*(const unsigned char *) &one) ? LSBFirst : MSBFirst;
+}
+
+
+/* Divide every 16-bit lane of a word by 255, rounding */
+static inline uint32_t _lanes_div255(uint32_t x)
+{
+    x += 0x00800080u;
+    return ((x + ((x >> 8) & 0x00FF00FFu)) >> 8) & 0x00FF00FFu;
+}
+
+
+/* Row kernel: blend ARGB pixels over an opaque background, giving
+ * 0xFFRRGGBB pixels; red and blue share a multiplication (SWAR) */
+static void _row_flatten(const uint32_t *restrict src,
+        uint32_t *restrict dst, uint32_t background, unsigned int width)
+{
+    uint32_t bg_rb = background & 0x00FF00FFu;
+    uint32_t bg_g = (background >> 8) & 0xFFu;
+
+    for (unsigned int x = 0; x < width; ++x) {
+        uint32_t pixel = src[x];
+        uint32_t alpha = pixel >> 24;
+        uint32_t rb = (pixel & 0x00FF00FFu) * alpha +
+            bg_rb * (255u - alpha);
+        uint32_t g = ((pixel >> 8) & 0xFFu) * alpha +
+            bg_g * (255u - alpha);
+        dst[x] = 0xFF000000u | _lanes_div255(rb) |
+            (_lanes_div255(g) << 8);
+    }
+}
+
+
+/* Row kernel: premultiply ARGB pixels by their alpha; red and blue
+ * share a multiplication (SWAR) */
+static void _row_premultiply(const uint32_t *restrict src,
+        uint32_t *restrict dst, unsigned int width)
+{
+    for (unsigned int x = 0; x < width; ++x) {
+        uint32_t pixel = src[x];
+        uint32_t alpha = pixel >> 24;
+        uint32_t rb = _lanes_div255((pixel & 0x00FF00FFu) * alpha);
+        uint32_t g = _lanes_div255(((pixel >> 8) & 0xFFu) * alpha);
+        dst[x] = (alpha << 24) | rb | (g << 8);
+    }
+}
+
+
+/* Place an 8-bit channel value in a visual color mask */
+static unsigned long _channel_to_mask(uint32_t value, unsigned long mask)
+{
+    unsigned int shift = 0;
+    unsigned long bits;
+
+    if (mask == 0) {
+        return 0;
+    }
+    while (!((mask >> shift) & 1)) {
+        ++shift;
+    }
+    bits = mask >> shift;
+
+    return (((unsigned long) value * bits + 127) / 255) << shift;
+}
+
+
+/* Allocate a new pixel buffer */
+pixbuf_td *pixbuf_new(unsigned int width, unsigned int height)
+{
+    pixbuf_td *pixbuf = malloc(sizeof(pixbuf_td));
+    if (!pixbuf) {
+        return NULL;
+    }
+
+    pixbuf->width = width;
+    pixbuf->height = height;
+    pixbuf->data = malloc((size_t) width * height * sizeof(uint32_t));
+    if (!pixbuf->data && width > 0 && height > 0) {
+        free(pixbuf);
+        return NULL;
+    }
+
+    return pixbuf;
+}
+
+
+/* Release a pixel buffer */
+void pixbuf_destroy(pixbuf_td *pixbuf)
+{
+    if (pixbuf) {
+        free(pixbuf->data);
+        free(pixbuf);
+    }
+}
+
+
+/* Scale a pixel buffer into a new one */
+pixbuf_td *pixbuf_scale(const pixbuf_td *pixbuf,
+        unsigned int width, unsigned int height, scale_filter_td filter)
+{
+    pixbuf_td *scaled = pixbuf_new(width, height);
+    if (!scaled) {
+        return NULL;
+    }
+
+    if (scale_rgb32(pixbuf->data, pixbuf->width, pixbuf->height,
+                pixbuf->width, scaled->data, width, height, width,
+                filter) != 0) {
+        pixbuf_destroy(scaled);
+        return NULL;
+    }
+
+    return scaled;
+}
+
+
+/* Convert a pixel buffer into a new image of the default visual */
+XImage *pixbuf_to_image(Display *display, const pixbuf_td *pixbuf,
+        unsigned long background)
+{
+    int screen = DefaultScreen(display);
+    Visual *visual = DefaultVisual(display, screen);
+    unsigned int depth = (unsigned int) DefaultDepth(display, screen);
+
+    XImage *image = XCreateImage(display, visual, depth, ZPixmap, 0, NULL,
+            pixbuf->width, pixbuf->height, 32/*bits*/, 0);
+    if (!image) {
+        return NULL;
+    }
+    image->data = malloc((size_t) image->bytes_per_line * pixbuf->height);
+    if (!image->data) {
+        XDestroyImage(image);
+        return NULL;
+    }
+
+    if (image->bits_per_pixel == 32 && (depth == 24 || depth == 32) &&
+            image->byte_order == _host_byte_order() &&
+            visual->red_mask == 0xFF0000 &&
+            visual->green_mask == 0x00FF00 &&
+            visual->blue_mask == 0x0000FF) {
+        /* Fast path: the blended pixel is already the visual pixel */
+        for (unsigned int y = 0; y < pixbuf->height; ++y) {
+            _row_flatten(pixbuf->data + (size_t) y * pixbuf->width,
+                    (uint32_t *) (void *) (image->data +
+                        (size_t) y * (size_t) image->bytes_per_line),
+                    (uint32_t) background, pixbuf->width);
+        }
+    } else {
+        /* Any other visual: compose the pixel from the color masks, or
+         * use black or white if the visual has no masks */
+        uint32_t *row = malloc(pixbuf->width * sizeof(*row));
+        if (!row) {
+            XDestroyImage(image);
+            return NULL;
+        }
+        for (unsigned int y = 0; y < pixbuf->height; ++y) {
+            _row_flatten(pixbuf->data + (size_t) y * pixbuf->width, row,
+                    (uint32_t) background, pixbuf->width);
+            for (unsigned int x = 0; x < pixbuf->width; ++x) {
+                uint32_t r = (row[x] >> 16) & 0xFF;
+                uint32_t g = (row[x] >> 8) & 0xFF;
+                uint32_t b = row[x] & 0xFF;
+                unsigned long pixel;
+                if (visual->red_mask && visual->green_mask &&
+                        visual->blue_mask) {
+                    pixel = _channel_to_mask(r, visual->red_mask) |
+                        _channel_to_mask(g, visual->green_mask) |
+                        _channel_to_mask(b, visual->blue_mask);
+                } else {
+                    pixel = (r * 3 + g * 6 + b >= 1280) ?
+                        WhitePixel(display, screen) :
+                        BlackPixel(display, screen);
+                }
+                XPutPixel(image, (int) x, (int) y, pixel);
+            }
+        }
+        free(row);
+    }
+
+    return image;
+}
+
+
+/* Upload a pixel buffer into a new pixmap */
+Pixmap pixbuf_to_pixmap(Display *display, const pixbuf_td *pixbuf,
+        unsigned long background)
+{
+    int screen = DefaultScreen(display);
+
+    XImage *image = pixbuf_to_image(display, pixbuf, background);
+    if (!image) {
+        return None;
+    }
+
+    Pixmap pixmap = XCreatePixmap(display, RootWindow(display, screen),
+            pixbuf->width, pixbuf->height, (unsigned int) image->depth);
+    upload_image(display, pixmap, DefaultGC(display, screen), image,
+            0, 0, 0, 0, pixbuf->width, pixbuf->height);
+    XDestroyImage(image);
+
+    return pixmap;
+}
+
+
+/* Upload a pixel buffer into a new 32 bits ARGB pixmap */
+Pixmap pixbuf_to_pixmap_argb(Display *display, const pixbuf_td *pixbuf)
+{
+    int screen = DefaultScreen(display);
+
+    XImage *image = XCreateImage(display, DefaultVisual(display, screen),
+            32/*depth*/, ZPixmap, 0, NULL, pixbuf->width, pixbuf->height,
+            32/*bits*/, 0);
+    if (!image) {
+        return None;
+    }
+    image->data = malloc((size_t) image->bytes_per_line * pixbuf->height);
+    if (!image->data || image->bits_per_pixel != 32) {
+        XDestroyImage(image);
+        return None;
+    }
+
+    /* Pixels are written as words of this machine; Xlib swaps them if
+     * the server needs it */
+    image->byte_order = _host_byte_order();
+    for (unsigned int y = 0; y < pixbuf->height; ++y) {
+        _row_premultiply(pixbuf->data + (size_t) y * pixbuf->width,
+                (uint32_t *) (void *) (image->data +
+                    (size_t) y * (size_t) image->bytes_per_line),
+                pixbuf->width);
+    }
+
+    /* The default GC is for the default depth only */
+    Pixmap pixmap = XCreatePixmap(display, RootWindow(display, screen),
+            pixbuf->width, pixbuf->height, 32);
+    GC gc = XCreateGC(display, pixmap, 0, NULL);
+    upload_image(display, pixmap, gc, image,
+            0, 0, 0, 0, pixbuf->width, pixbuf->height);
+    XFreeGC(display, gc);
+    XDestroyImage(image);
+
+    return pixmap;
+}
@@ -0,0 +1,272 @@
+/**
+ * @file place.c
+ *
+ * @brief Placement of icons on free areas of the screen implementation
+ */
+/*
+ * ISC License
+ * Copyright (c) 2025, J. A. Corbal <jacorbal@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS.  IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS
+ * ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF
+ * THIS SOFTWARE.
+ */
+
+/* Standard library includes */
+#include <stdlib.h>     /* calloc, free, realloc */
+
+/* X includes */
+#include <X11/Xlib.h>   /* Bool, False, True, XRectangle */
+
+/* Local includes */
+#include <place.h>
+
+
+/* Range of cells covering a range of coordinates, clamped to the grid */
+static void _cells_range(int origin, unsigned int cells, int from, int to,
+        unsigned int *first, unsigned int *last)
+{
+    long long a = ((long long) from - origin) / PLACE_CELL_SIZE;
+    long long b = ((long long) to - 1 - origin) / PLACE_CELL_SIZE;
+
+    *first = (a < 0) ? 0 : (a >= cells) ? cells - 1 : (unsigned int) a;
+    *last = (b < 0) ? 0 : (b >= cells) ? cells - 1 : (unsigned int) b;
+}
+
+
+/* Cell of a grid */
+static inline place_cell_td *_cell(const place_td *place,
+        unsigned int column, unsigned int row)
+{
+    return &place->cells[(size_t) row * place->columns + column];
+}
+
+
+/* Initialize an empty grid over the screen */
+int place_init(place_td *place, int x, int y,
+        unsigned int width, unsigned int height, unsigned int gap)
+{
+    place->x = x;
+    place->y = y;
+    place->width = (width > 0) ? width : 1;
+    place->height = (height > 0) ? height : 1;
+    place->gap = gap;
+    place->columns = (place->width + PLACE_CELL_SIZE - 1) / PLACE_CELL_SIZE;
+    place->rows = (place->height + PLACE_CELL_SIZE - 1) / PLACE_CELL_SIZE;
+    place->cells = calloc((size_t) place->columns * place->rows,
+            sizeof(*place->cells));
+
+    return (place->cells) ? 0 : -1;
+}
+
+
+/* Release a grid; its items are left as they are */
+void place_release(place_td *place)
+{
+    if (!place->cells) {
+        return;
+    }
+    for (size_t i = 0; i < (size_t) place->columns * place->rows; ++i) {
+        for (unsigned int n = 0; n < place->cells[i].count; ++n) {
+            place->cells[i].items[n]->placed = False;
+        }
+        free(place->cells[i].items);
+    }
+    free(place->cells);
+    place->cells = NULL;
+}
+
+
+/* Whether an area, and the gap around it, is free of other items */
+static Bool _area_free(const place_td *place, const place_item_td *self,
+        int x, int y)
+{
+    int gap = (int) place->gap;
+    int right = x + (int) self->width;
+    int bottom = y + (int) self->height;
+    unsigned int c0, c1, r0, r1;
+
+    _cells_range(place->x, place->columns, x - gap, right + gap, &c0, &c1);
+    _cells_range(place->y, place->rows, y - gap, bottom + gap, &r0, &r1);
+    for (unsigned int r = r0; r <= r1; ++r) {
+        for (unsigned int c = c0; c <= c1; ++c) {
+            const place_cell_td *cell = _cell(place, c, r);
+            for (unsigned int n = 0; n < cell->count; ++n) {
+                const place_item_td *other = cell->items[n];
+                if (other != self &&
+                        x < other->x + (int) other->width + gap &&
+                        other->x < right + gap &&
+                        y < other->y + (int) other->height + gap &&
+                        other->y < bottom + gap) {
+                    return False;
+                }
+            }
+        }
+    }
+
+    return True;
+}
+
+
+/* Clamp a position so that a size fits within a range */
+static int _clamp(int position, unsigned int size, int origin,
+        unsigned int extent)
+{
+    int last = origin + (int) extent - (int) size;
+
+    if (position > last) {
+        position = last;
+    }
+    return (position < origin) ? origin : position;
+}
+
+
+/* Find the nearest free slot to the anchor of an item */
+Bool place_find(const place_td *place, place_item_td *item,
+        const XRectangle *bounds)
+{
+    int left = (bounds) ? bounds->x : place->x;
+    int top = (bounds) ? bounds->y : place->y;
+    unsigned int width = (bounds) ? bounds->width : place->width;
+    unsigned int height = (bounds) ? bounds->height : place->height;
+    long long step_x = (long long) item->width + place->gap;
+    long long step_y = (long long) item->height + place->gap;
+    int x0 = _clamp(item->x_anchor, item->width, left, width);
+    int y0 = _clamp(item->y_anchor, item->height, top, height);
+
+    /* The anchor itself, if free */
+    item->x = x0;
+    item->y = y0;
+    if (_area_free(place, item, x0, y0)) {
+        return True;
+    }
+
+    /* Or else the slots of the area, laid out from its corner for icons
+     * of this size, so that a slot left by an icon is taken again; ring
+     * after ring around the slot of the anchor */
+    long long i0 = ((long long) x0 - left + step_x / 2) / step_x;
+    long long j0 = ((long long) y0 - top + step_y / 2) / step_y;
+    long long columns = ((long long) width + place->gap) / step_x;
+    long long rows = ((long long) height + place->gap) / step_y;
+    long long rings = (columns > rows) ? columns : rows;
+
+    for (long long ring = 0; ring <= rings; ++ring) {
+        long long best = -1;
+
+        /* Every slot of the ring, along its four sides */
+        for (long long j = j0 - ring; j <= j0 + ring; ++j) {
+            long long step = (j == j0 - ring || j == j0 + ring) ?
+                1 : 2 * ring;
+            if (j < 0 || j >= rows) {
+                continue;
+            }
+            for (long long i = i0 - ring; i <= i0 + ring; i += step) {
+                if (i < 0 || i >= columns) {
+                    continue;
+                }
+                long long x = left + i * step_x;
+                long long y = top + j * step_y;
+                long long distance = (x - x0) * (x - x0) +
+                    (y - y0) * (y - y0);
+                if ((best < 0 || distance < best) &&
+                        _area_free(place, item, (int) x, (int) y)) {
+                    best = distance;
+                    item->x = (int) x;
+                    item->y = (int) y;
+                }
+            }
+        }
+        if (best >= 0) {
+            return True;
+        }
+    }
+
+    item->x = x0;
+    item->y = y0;
+
+    return False;
+}
+
+
+/* Add an item at its position */
+int place_add(place_td *place, place_item_td *item)
+{
+    unsigned int c0, c1, r0, r1;
+
+    if (item->placed) {
+        return 0;
+    }
+    _cells_range(place->x, place->columns, item->x,
+            item->x + (int) item->width, &c0, &c1);
+    _cells_range(place->y, place->rows, item->y,
+            item->y + (int) item->height, &r0, &r1);
+    for (unsigned int r = r0; r <= r1; ++r) {
+        for (unsigned int c = c0; c <= c1; ++c) {
+            place_cell_td *cell = _cell(place, c, r);
+            if (cell->count == cell->capacity) {
+                unsigned int capacity = (cell->capacity) ?
+                    2 * cell->capacity : 4;
+                place_item_td **items = realloc(cell->items,
+                        capacity * sizeof(*items));
+                if (!items) {
+                    item->placed = True;    /* Undo the cells done */
+                    place_remove(place, item);
+                    return -1;
+                }
+                cell->items = items;
+                cell->capacity = capacity;
+            }
+            cell->items[cell->count++] = item;
+        }
+    }
+    item->placed = True;
+
+    return 0;
+}
+
+
+/* Remove an item, if added */
+void place_remove(place_td *place, place_item_td *item)
+{
+    unsigned int c0, c1, r0, r1;
+
+    if (!item->placed) {
+        return;
+    }
+    _cells_range(place->x, place->columns, item->x,
+            item->x + (int) item->width, &c0, &c1);
+    _cells_range(place->y, place->rows, item->y,
+            item->y + (int) item->height, &r0, &r1);
+    for (unsigned int r = r0; r <= r1; ++r) {
+        for (unsigned int c = c0; c <= c1; ++c) {
+            place_cell_td *cell = _cell(place, c, r);
+            for (unsigned int n = 0; n < cell->count; ++n) {
+                if (cell->items[n] == item) {
+                    cell->items[n] = cell->items[--cell->count];
+                    break;
+                }
+            }
+        }
+    }
+    item->placed = False;
+}
+
+
+/* Move an item, which is anchored at its new position */
+int place_move(place_td *place, place_item_td *item, int x, int y)
+{
+    place_remove(place, item);
+    item->x = item->x_anchor = x;
+    item->y = item->y_anchor = y;
+
+    return place_add(place, item);
+}
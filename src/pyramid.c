@@ -0,0 +1,354 @@
+/**
+ * @file pyramid.c
+ *
+ * @brief Icons at several sizes, scaled from the closest larger one
+ *        implementation
+ */
+/*
+ * ISC License
+ * Copyright (c) 2025, J. A. Corbal <jacorbal@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS.  IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS
+ * ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF
+ * THIS SOFTWARE.
+ */
+
+/* Enable features from the POSIX.1-2008 standard */
+#define _POSIX_C_SOURCE 200809L
+
+/* Standard library includes */
+#include <ctype.h>      /* isdigit */
+#include <dirent.h>     /* DIR, closedir, opendir, readdir */
+#include <stdint.h>     /* int64_t, uint64_t */
+#include <stdio.h>      /* snprintf */
+#include <stdlib.h>     /* calloc, free */
+#include <string.h>     /* memcpy, memmove, memset, strcmp, strlen, ... */
+#include <sys/stat.h>   /* stat */
+
+/* Local includes */
+#include <defaults.h>
+#include <imgfile.h>
+#include <pixbuf.h>
+#include <pyramid.h>
+#include <scale.h>
+
+
+/* Length of a '_<width>x<height>' size suffix at the end of a name, or
+ * 0 if there is none */
+static size_t _size_suffix(const char *name, size_t length)
+{
+    size_t i = length;
+    size_t digits;
+
+    for (digits = 0; i > 0 && isdigit((unsigned char) name[i - 1]);
+            ++digits) {
+        --i;
+    }
+    if (digits == 0 || i == 0 || name[--i] != 'x') {
+        return 0;
+    }
+    for (digits = 0; i > 0 && isdigit((unsigned char) name[i - 1]);
+            ++digits) {
+        --i;
+    }
+    if (digits == 0 || i == 0 || name[--i] != '_') {
+        return 0;
+    }
+
+    return length - i;
+}
+
+
+/* Insert a level, keeping the largest first; returns the level of its
+ * size in the pyramid, which may be an older one, or NULL if full */
+static pixbuf_td *_level_insert(pyramid_td *pyramid, pixbuf_td *level)
+{
+    unsigned int i;
+
+    for (i = 0; i < pyramid->count; ++i) {
+        pixbuf_td *other = pyramid->levels[i];
+        if (other->width == level->width &&
+                other->height == level->height) {
+            pixbuf_destroy(level);
+            return other;
+        }
+        if ((unsigned long) other->width * other->height <
+                (unsigned long) level->width * level->height) {
+            break;
+        }
+    }
+    if (pyramid->count == PYRAMID_MAX_LEVELS) {
+        pixbuf_destroy(level);
+        return NULL;
+    }
+    memmove(&pyramid->levels[i + 1], &pyramid->levels[i],
+            (pyramid->count - i) * sizeof(*pyramid->levels));
+    pyramid->levels[i] = level;
+    pyramid->count++;
+
+    return level;
+}
+
+
+/**
+ * @typedef variants_td
+ *
+ * @brief Listing of the variants of an icon at other sizes, in the same
+ *        directory and with the same extension: '<base>.<ext>' and
+ *        '<base>_<w>x<h>.<ext>'
+ */
+typedef struct {
+    DIR *d;                     /**< Directory being read */
+    char dir[MAX_PATH_LENGTH];  /**< Its path */
+    const char *name;           /**< Name of the icon file */
+    size_t base;                /**< Length of the base of the name */
+    const char *ext;            /**< Extension, with its dot, or "" */
+    size_t ext_length;          /**< Its length */
+} variants_td;
+
+
+/* Start listing the variants of an icon; -1 if there are none */
+static int _variants_open(variants_td *variants, const char *path)
+{
+    const char *slash = strrchr(path, '/');
+    const char *name = (slash) ? slash + 1 : path;
+    const char *dot = strrchr(name, '.');
+    size_t stem = (dot) ? (size_t) (dot - name) : strlen(name);
+
+    variants->name = name;
+    variants->ext = name + stem;
+    variants->ext_length = strlen(variants->ext);
+    variants->base = stem - _size_suffix(name, stem);
+    if (variants->base == 0) {
+        return -1;
+    }
+    if (!slash) {
+        snprintf(variants->dir, sizeof(variants->dir), ".");
+    } else if (slash == path) {
+        snprintf(variants->dir, sizeof(variants->dir), "/");
+    } else {
+        snprintf(variants->dir, sizeof(variants->dir), "%.*s",
+                (int) (slash - path), path);
+    }
+    variants->d = opendir(variants->dir);
+
+    return (variants->d) ? 0 : -1;
+}
+
+
+/* Path of the next variant of an icon, other than the icon itself;
+ * 0 once there are no more, and the listing is then closed */
+static int _variants_next(variants_td *variants, char *variant,
+        size_t size)
+{
+    struct dirent *entry;
+
+    while ((entry = readdir(variants->d))) {
+        const char *other = entry->d_name;
+        size_t length = strlen(other);
+        if (length < variants->base + variants->ext_length ||
+                strncmp(other, variants->name, variants->base) != 0 ||
+                strcmp(other + length - variants->ext_length,
+                    variants->ext) != 0 ||
+                strcmp(other, variants->name) == 0) {
+            continue;
+        }
+        /* Nothing but a size suffix between the base and the extension */
+        size_t suffix = length - variants->ext_length - variants->base;
+        if (suffix > 0 && _size_suffix(other,
+                    length - variants->ext_length) != suffix) {
+            continue;
+        }
+        if (snprintf(variant, size, "%s/%s", variants->dir, other) <
+                (int) size) {
+            return 1;
+        }
+    }
+    closedir(variants->d);
+    variants->d = NULL;
+
+    return 0;
+}
+
+
+/* Stop listing the variants of an icon before the last one */
+static void _variants_close(variants_td *variants)
+{
+    if (variants->d) {
+        closedir(variants->d);
+        variants->d = NULL;
+    }
+}
+
+
+/* Read the variants of an icon at other sizes */
+static void _variants_load(pyramid_td *pyramid, const char *path)
+{
+    char variant[MAX_PATH_LENGTH];
+    variants_td variants;
+
+    if (_variants_open(&variants, path) != 0) {
+        return;
+    }
+    while (pyramid->count < PYRAMID_MAX_LEVELS &&
+            _variants_next(&variants, variant, sizeof(variant))) {
+        pixbuf_td *level = imgfile_read(variant);
+        if (level) {
+            _level_insert(pyramid, level);
+        }
+    }
+    _variants_close(&variants);
+}
+
+
+/* Hash (FNV-1a, 64 bits) of a byte sequence, continuing a hash */
+static uint64_t _hash(uint64_t hash, const void *data, size_t length)
+{
+    const unsigned char *bytes = data;
+    for (size_t i = 0; i < length; ++i) {
+        hash = (hash ^ bytes[i]) * 0x100000001B3ull;
+    }
+    return hash;
+}
+
+
+/* Hash of a file as it is now: which one it is, its size and its time */
+static uint64_t _file_hash(uint64_t hash, const struct stat *st)
+{
+    struct {
+        uint64_t dev, ino;
+        int64_t size;
+        int64_t mtime_sec, mtime_nsec;
+    } file;
+
+    memset(&file, 0, sizeof(file));     /* No padding garbage */
+    file.dev = (uint64_t) st->st_dev;
+    file.ino = (uint64_t) st->st_ino;
+    file.size = (int64_t) st->st_size;
+    file.mtime_sec = (int64_t) st->st_mtim.tv_sec;
+    file.mtime_nsec = (int64_t) st->st_mtim.tv_nsec;
+
+    return _hash(hash, &file, sizeof(file));
+}
+
+
+/* Stamp of an icon file and of its variants, as they are now */
+int pyramid_stamp(const char *path, uint64_t *stamp)
+{
+    char variant[MAX_PATH_LENGTH];
+    variants_td variants;
+    struct stat st;
+    uint64_t others = 0;
+
+    if (stat(path, &st) != 0) {
+        return -1;
+    }
+
+    /* Every variant, whatever the order the directory lists them in */
+    if (_variants_open(&variants, path) == 0) {
+        while (_variants_next(&variants, variant, sizeof(variant))) {
+            struct stat other;
+            if (stat(variant, &other) == 0) {
+                uint64_t hash = _hash(0xCBF29CE484222325ull, variant,
+                        strlen(variant));
+                others += _file_hash(hash, &other);
+            }
+        }
+    }
+    *stamp = _file_hash(0xCBF29CE484222325ull, &st);
+    *stamp = _hash(*stamp, &others, sizeof(others));
+
+    return 0;
+}
+
+
+/* Read an icon file, and its variants at other sizes */
+pyramid_td *pyramid_load(const char *path)
+{
+    pixbuf_td *level = imgfile_read(path);
+    if (!level) {
+        return NULL;
+    }
+
+    pyramid_td *pyramid = calloc(1, sizeof(*pyramid));
+    if (!pyramid) {
+        pixbuf_destroy(level);
+        return NULL;
+    }
+    pyramid->levels[0] = level;
+    pyramid->count = 1;
+    _variants_load(pyramid, path);
+
+    return pyramid;
+}
+
+
+/* Get the level to scale an icon from */
+const pixbuf_td *pyramid_level(pyramid_td *pyramid,
+        unsigned int width, unsigned int height)
+{
+    unsigned int i = 0;
+
+    /* Smallest level that is not smaller than the icon */
+    while (i + 1 < pyramid->count &&
+            pyramid->levels[i + 1]->width >= width &&
+            pyramid->levels[i + 1]->height >= height) {
+        ++i;
+    }
+
+    /* Halve it while it stays at least as large as the icon; the new
+     * levels are kept for other sizes */
+    pixbuf_td *level = pyramid->levels[i];
+    while (level->width / 2 >= width && level->height / 2 >= height &&
+            level->width / 2 > 0 && level->height / 2 > 0) {
+        pixbuf_td *half = pixbuf_scale(level, level->width / 2,
+                level->height / 2, SCALE_BOX);
+        if (!half || !(half = _level_insert(pyramid, half))) {
+            break;
+        }
+        level = half;
+    }
+
+    return level;
+}
+
+
+/* Scale an icon from its closest larger level */
+pixbuf_td *pyramid_scale(pyramid_td *pyramid,
+        unsigned int width, unsigned int height, scale_filter_td filter)
+{
+    const pixbuf_td *level = pyramid_level(pyramid, width, height);
+
+    if (level->width != width || level->height != height) {
+        return pixbuf_scale(level, width, height, filter);
+    }
+
+    pixbuf_td *copy = pixbuf_new(width, height);
+    if (copy) {
+        memcpy(copy->data, level->data,
+                (size_t) width * height * sizeof(*copy->data));
+    }
+
+    return copy;
+}
+
+
+/* Release a pyramid and all its levels */
+void pyramid_destroy(pyramid_td *pyramid)
+{
+    if (pyramid) {
+        for (unsigned int i = 0; i < pyramid->count; ++i) {
+            pixbuf_destroy(pyramid->levels[i]);
+        }
+        free(pyramid);
+    }
+}
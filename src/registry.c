@@ -0,0 +1,171 @@
+/**
+ * @file registry.c
+ *
+ * @brief Pixmaps shared by every icon of the same content implementation
+ */
+/*
+ * ISC License
+ * Copyright (c) 2025, J. A. Corbal <jacorbal@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS.  IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS
+ * ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF
+ * THIS SOFTWARE.
+ */
+
+/* Standard library includes */
+#include <stdint.h>     /* uint64_t */
+#include <stdlib.h>     /* free, malloc */
+
+/* X includes */
+#include <X11/Xlib.h>   /* Bool, Display, Pixmap, XFreePixmap */
+
+/* Local includes */
+#include <registry.h>
+
+
+/* Number of buckets; a daemon seldom has more icons than that */
+#define REGISTRY_BUCKETS (256)
+
+
+/**
+ * @typedef registry_entry_td
+ *
+ * @brief Shared pixmap, chained in its bucket
+ */
+typedef struct registry_entry {
+    struct registry_entry *next;    /**< Next entry of the bucket */
+    Display *display;       /**< Display where the pixmap is */
+    uint64_t key;           /**< Key of the pixmap */
+    Pixmap pixmap;          /**< Shared pixmap */
+    unsigned int width;     /**< Pixmap width (px) */
+    unsigned int height;    /**< Pixmap height (px) */
+    Bool alpha;             /**< Pixmap is ARGB */
+    unsigned int users;     /**< Icons using the pixmap */
+} registry_entry_td;
+
+
+/* Shared pixmaps, by key */
+static registry_entry_td *_buckets[REGISTRY_BUCKETS];
+static unsigned int _count = 0;
+
+
+/* Hash (FNV-1a, 64 bits) some data into a key */
+uint64_t registry_key(uint64_t key, const void *data, size_t length)
+{
+    const unsigned char *bytes = data;
+
+    for (size_t i = 0; i < length; ++i) {
+        key = (key ^ bytes[i]) * 0x100000001B3ull;
+    }
+
+    return (key == REGISTRY_NONE) ? 1 : key;
+}
+
+
+/* Link to the entry of a key, or to the end of its bucket */
+static registry_entry_td **_entry_find(Display *display, uint64_t key)
+{
+    registry_entry_td **link = &_buckets[key % REGISTRY_BUCKETS];
+
+    while (*link && ((*link)->key != key || (*link)->display != display)) {
+        link = &(*link)->next;
+    }
+
+    return link;
+}
+
+
+/* Get a shared pixmap, and count one more user */
+Pixmap registry_get(Display *display, uint64_t key,
+        unsigned int *width, unsigned int *height, Bool *alpha)
+{
+    if (key == REGISTRY_NONE) {
+        return None;
+    }
+
+    registry_entry_td *entry = *_entry_find(display, key);
+    if (!entry) {
+        return None;
+    }
+    entry->users++;
+    if (width) {
+        *width = entry->width;
+    }
+    if (height) {
+        *height = entry->height;
+    }
+    if (alpha) {
+        *alpha = entry->alpha;
+    }
+
+    return entry->pixmap;
+}
+
+
+/* Share a new pixmap, with a single user */
+void registry_add(Display *display, uint64_t key, Pixmap pixmap,
+        unsigned int width, unsigned int height, Bool alpha)
+{
+    if (key == REGISTRY_NONE || pixmap == None) {
+        return;
+    }
+
+    registry_entry_td **link = _entry_find(display, key);
+    if (*link) {
+        return;     /* Made twice; the second one stays private */
+    }
+    registry_entry_td *entry = malloc(sizeof(*entry));
+    if (!entry) {
+        return;
+    }
+    entry->next = NULL;
+    entry->display = display;
+    entry->key = key;
+    entry->pixmap = pixmap;
+    entry->width = width;
+    entry->height = height;
+    entry->alpha = alpha;
+    entry->users = 1;
+    *link = entry;
+    _count++;
+}
+
+
+/* Release a pixmap, freed when it has no user left */
+void registry_release(Display *display, uint64_t key, Pixmap pixmap)
+{
+    if (pixmap == None) {
+        return;
+    }
+
+    registry_entry_td **link = (key != REGISTRY_NONE) ?
+        _entry_find(display, key) : NULL;
+    registry_entry_td *entry = (link) ? *link : NULL;
+    if (!entry || entry->pixmap != pixmap) {
+        XFreePixmap(display, pixmap);   /* Never shared */
+        return;
+    }
+    if (--entry->users > 0) {
+        return;
+    }
+    *link = entry->next;
+    XFreePixmap(display, entry->pixmap);
+    free(entry);
+    _count--;
+}
+
+
+/* Count the pixmaps shared */
+unsigned int registry_count(void)
+{
+    return _count;
+}
@@ -0,0 +1,272 @@
+/**
+ * @file render.c
+ *
+ * @brief Server-side scaling and blending through XRender implementation
+ */
+/*
+ * ISC License
+ * Copyright (c) 2025, J. A. Corbal <jacorbal@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS.  IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS
+ * ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF
+ * THIS SOFTWARE.
+ */
+
+/* Standard library includes */
+#include <stddef.h>     /* size_t */
+#include <stdlib.h>     /* free, malloc */
+#include <string.h>     /* memcpy, memset */
+
+/* X includes */
+#include <X11/Xlib.h>                   /* Display, Drawable, Pixmap */
+#include <X11/extensions/Xrender.h>     /* XRender*, Picture, XTransform */
+
+/* Local includes */
+#include <font.h>
+#include <render.h>
+#include <scale.h>
+
+
+/* Largest side of the box convolution (px); larger reductions sample
+ * the source, as the request would get too big */
+#define RENDER_BOX_MAX (64)
+
+
+/* Bytes per row of a glyph image: 8 bits per pixel, padded to 32 */
+#define RENDER_GLYPH_STRIDE ((FONT_WIDTH + 3) & ~3)
+
+/* Glyphs translated at once, so that the text needs no copy */
+#define RENDER_TEXT_CHUNK (256)
+
+
+/* Availability of RENDER in the last display asked about */
+static Display *_render_display = NULL;
+static Bool _render_ready = False;
+
+/* Glyphs of the built-in font, sent to the last display drawn on */
+static Display *_glyphs_display = NULL;
+static GlyphSet _glyphs = None;
+
+
+/* Set the box convolution of a reduction, or a plain filter */
+static void _filter_set(Display *display, Picture picture,
+        unsigned int src_width, unsigned int src_height,
+        unsigned int width, unsigned int height, scale_filter_td filter)
+{
+    unsigned int box_width = (src_width + width - 1) / width;
+    unsigned int box_height = (src_height + height - 1) / height;
+
+    if (filter == SCALE_NEAREST ||
+            (src_width == width && src_height == height)) {
+        XRenderSetPictureFilter(display, picture, FilterNearest, NULL, 0);
+        return;
+    }
+    if (filter == SCALE_BILINEAR || (box_width <= 1 && box_height <= 1)) {
+        XRenderSetPictureFilter(display, picture, FilterBilinear, NULL, 0);
+        return;
+    }
+
+    /* Box: every tap weighs the same; the kernel is centred on the
+     * source position of every destination pixel */
+    box_width = (box_width > RENDER_BOX_MAX) ? RENDER_BOX_MAX : box_width;
+    box_height = (box_height > RENDER_BOX_MAX) ?
+        RENDER_BOX_MAX : box_height;
+    int count = (int) (box_width * box_height);
+    XFixed *params = malloc((size_t) (count + 2) * sizeof(*params));
+    if (!params) {
+        XRenderSetPictureFilter(display, picture, FilterBilinear, NULL, 0);
+        return;
+    }
+    params[0] = XDoubleToFixed(box_width);
+    params[1] = XDoubleToFixed(box_height);
+    for (int i = 0; i < count; ++i) {
+        params[i + 2] = XDoubleToFixed(1.0 / count);
+    }
+    XRenderSetPictureFilter(display, picture, FilterConvolution, params,
+            count + 2);
+    free(params);
+}
+
+
+/* Whether the display can scale and blend pictures */
+Bool render_available(Display *display)
+{
+    int event_base, error_base;
+    int major = 0, minor = 0;
+
+    if (display != _render_display) {
+        _render_display = display;
+        _render_ready =
+            XRenderQueryExtension(display, &event_base, &error_base) &&
+            XRenderQueryVersion(display, &major, &minor) &&
+            (major > 0 || minor >= 10) &&   /* RepeatPad */
+            XRenderFindStandardFormat(display, PictStandardARGB32) &&
+            XRenderFindVisualFormat(display, DefaultVisual(display,
+                        DefaultScreen(display)));
+    }
+
+    return _render_ready;
+}
+
+
+/* Scale a pixmap and blend it over a drawable of the default visual */
+Bool render_composite(Display *display, Pixmap pixmap, Bool alpha,
+        unsigned int src_width, unsigned int src_height,
+        Drawable drawable, int x, int y,
+        unsigned int width, unsigned int height,
+        scale_filter_td filter)
+{
+    XRenderPictureAttributes attributes;
+
+    if (!render_available(display) || width == 0 || height == 0) {
+        return False;
+    }
+
+    XRenderPictFormat *visual_format = XRenderFindVisualFormat(display,
+            DefaultVisual(display, DefaultScreen(display)));
+    XRenderPictFormat *src_format = (alpha) ?
+        XRenderFindStandardFormat(display, PictStandardARGB32) :
+        visual_format;
+
+    /* Edges are extended, so filters do not blend them with nothing */
+    attributes.repeat = RepeatPad;
+    Picture src = XRenderCreatePicture(display, pixmap, src_format,
+            CPRepeat, &attributes);
+    Picture dst = XRenderCreatePicture(display, drawable, visual_format,
+            0, NULL);
+
+    /* Destination pixels map to source pixels */
+    XTransform transform = { {
+        { XDoubleToFixed((double) src_width / width), 0, 0 },
+        { 0, XDoubleToFixed((double) src_height / height), 0 },
+        { 0, 0, XDoubleToFixed(1.0) },
+    } };
+    XRenderSetPictureTransform(display, src, &transform);
+    _filter_set(display, src, src_width, src_height, width, height,
+            filter);
+
+    XRenderComposite(display, PictOpOver, src, None, dst,
+            0, 0, 0, 0, x, y, width, height);
+
+    XRenderFreePicture(display, src);
+    XRenderFreePicture(display, dst);
+
+    return True;
+}
+
+
+/* Send the glyphs of the built-in font, as 8 bits masks, once */
+static GlyphSet _glyphs_get(Display *display)
+{
+    static unsigned char images[FONT_LAST - FONT_FIRST + 1]
+        [FONT_HEIGHT * RENDER_GLYPH_STRIDE];
+    Glyph ids[FONT_LAST - FONT_FIRST + 1];
+    XGlyphInfo infos[FONT_LAST - FONT_FIRST + 1];
+    int count = FONT_LAST - FONT_FIRST + 1;
+
+    if (display == _glyphs_display && _glyphs != None) {
+        return _glyphs;
+    }
+
+    /* The glyphs of another display, which may be closed by now, are
+     * forgotten: the server frees them along with its connection */
+    _glyphs = None;
+    _glyphs_display = NULL;
+
+    XRenderPictFormat *format = XRenderFindStandardFormat(display,
+            PictStandardA8);
+    if (!format) {
+        return None;
+    }
+    memset(images, 0, sizeof(images));
+    for (int i = 0; i < count; ++i) {
+        for (int row = 0; row < FONT_HEIGHT; ++row) {
+            memcpy(images[i] + row * RENDER_GLYPH_STRIDE,
+                    font_glyphs[i][row], FONT_WIDTH);
+        }
+        ids[i] = (Glyph) (FONT_FIRST + i);
+        infos[i].width = FONT_WIDTH;
+        infos[i].height = FONT_HEIGHT;
+        infos[i].x = 0;
+        infos[i].y = FONT_ASCENT;
+        infos[i].xOff = FONT_WIDTH;
+        infos[i].yOff = 0;
+    }
+
+    _glyphs = XRenderCreateGlyphSet(display, format);
+    XRenderAddGlyphs(display, _glyphs, ids, infos, count,
+            (const char *) images, (int) sizeof(images));
+    _glyphs_display = display;
+
+    return _glyphs;
+}
+
+
+/* Draw a string with the built-in font over a drawable of the default
+ * visual */
+Bool render_text(Display *display, Drawable drawable, int x, int y,
+        const char *text, size_t length, unsigned long color)
+{
+    char glyphs[RENDER_TEXT_CHUNK];
+
+    if (!render_available(display)) {
+        return False;
+    }
+    GlyphSet glyph_set = _glyphs_get(display);
+    if (glyph_set == None) {
+        return False;
+    }
+
+    XRenderColor fill = {
+        (unsigned short) (((color >> 16) & 0xFF) * 0x101),
+        (unsigned short) (((color >> 8) & 0xFF) * 0x101),
+        (unsigned short) ((color & 0xFF) * 0x101),
+        0xFFFF
+    };
+    Picture src = XRenderCreateSolidFill(display, &fill);
+    Picture dst = XRenderCreatePicture(display, drawable,
+            XRenderFindVisualFormat(display, DefaultVisual(display,
+                    DefaultScreen(display))), 0, NULL);
+    XRenderPictFormat *mask_format = XRenderFindStandardFormat(display,
+            PictStandardA8);
+
+    /* Glyphs are numbered as their characters; any other one is '?' */
+    for (size_t done = 0; done < length; ) {
+        size_t chunk = length - done;
+        chunk = (chunk > RENDER_TEXT_CHUNK) ? RENDER_TEXT_CHUNK : chunk;
+        for (size_t i = 0; i < chunk; ++i) {
+            unsigned char c = (unsigned char) text[done + i];
+            glyphs[i] = (char) ((c >= FONT_FIRST && c <= FONT_LAST) ?
+                    c : '?');
+        }
+        XRenderCompositeString8(display, PictOpOver, src, dst,
+                mask_format, glyph_set, 0, 0, x, y, glyphs, (int) chunk);
+        x += (int) chunk * FONT_WIDTH;
+        done += chunk;
+    }
+
+    XRenderFreePicture(display, src);
+    XRenderFreePicture(display, dst);
+
+    return True;
+}
+
+
+/* Free the glyphs kept on the server for a display, if any */
+void render_release(Display *display)
+{
+    if (display && display == _glyphs_display && _glyphs != None) {
+        XRenderFreeGlyphSet(display, _glyphs);
+        _glyphs = None;
+        _glyphs_display = NULL;
+    }
+}
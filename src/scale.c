@@ -0,0 +1,492 @@
+/**
+ * @file scale.c
+ *
+ * @brief Client-side image scaling implementation
+ *
+ * Images are scaled in client memory so a whole pixmap needs a single
+ * @c XGetImage and a single @c XPutImage instead of one request per
+ * pixel.  The 32-bit kernels work a row at a time on contiguous
+ * buffers with no branches in the inner loops, which lets the compiler
+ * vectorize them; two channels are packed in every 32-bit word when
+ * interpolating (SWAR), so a pixel is blended with two multiplications.
+ */
+/*
+ * ISC License
+ * Copyright (c) 2025, J. A. Corbal <jacorbal@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS.  IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS
+ * ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF
+ * THIS SOFTWARE.
+ */
+
+/* Standard library includes */
+#include <stdint.h>     /* uint32_t, uint64_t */
+#include <stdlib.h>     /* calloc, free, malloc */
+#include <string.h>     /* memcpy, memset, strcmp */
+
+/* X includes */
+#include <X11/Xlib.h>   /* Display, XImage, X* */
+#include <X11/Xutil.h>  /* XGetPixel, XPutPixel, XDestroyImage */
+
+/* Local includes */
+#include <scale.h>
+
+
+/* Byte order of this machine, as X names it */
+static int _host_byte_order(void)
+{
+    const unsigned int one = 1;
+    return (*(const unsigned char *) &one) ? LSBFirst : MSBFirst;
+}
+
+
+/* Whether the image pixels can be handled as 32-bit words */
+static Bool _image_is_rgb32(const XImage *image)
+{
+    return image->format == ZPixmap &&
+        image->bits_per_pixel == 32 &&
+        (image->depth == 24 || image->depth == 32) &&
+        image->byte_order == _host_byte_order() &&
+        image->bytes_per_line % 4 == 0;
+}
+
+
+/* Map destination coordinates to source coordinates (pixel centers) */
+static void _map_nearest(unsigned int *map, unsigned int src_len,
+        unsigned int dst_len)
+{
+    for (unsigned int i = 0; i < dst_len; ++i) {
+        map[i] = (unsigned int) (((2 * (uint64_t) i + 1) * src_len) /
+                (2 * (uint64_t) dst_len));
+    }
+}
+
+
+/* Map destination coordinates to a pair of source coordinates and the
+ * weight (0..256) of the second one */
+static void _map_bilinear(unsigned int *map0, unsigned int *map1,
+        uint32_t *weight, unsigned int src_len, unsigned int dst_len)
+{
+    for (unsigned int i = 0; i < dst_len; ++i) {
+        /* Fixed point 24.8 position of the destination pixel center */
+        int64_t pos = (int64_t) (((2 * (uint64_t) i + 1) * src_len << 8) /
+                (2 * (uint64_t) dst_len)) - 128;
+        if (pos < 0) {
+            pos = 0;
+        }
+        unsigned int i0 = (unsigned int) (pos >> 8);
+        if (i0 >= src_len - 1) {
+            map0[i] = map1[i] = src_len - 1;
+            weight[i] = 0;
+        } else {
+            map0[i] = i0;
+            map1[i] = i0 + 1;
+            weight[i] = (uint32_t) (pos & 0xFF);
+        }
+    }
+}
+
+
+/* First source coordinate covered by a destination coordinate */
+static inline unsigned int _box_start(unsigned int i, unsigned int src_len,
+        unsigned int dst_len)
+{
+    return (unsigned int) (((uint64_t) i * src_len) / dst_len);
+}
+
+
+/* Source coordinate after the last one covered by a destination
+ * coordinate; spans are never empty */
+static inline unsigned int _box_end(unsigned int i, unsigned int src_len,
+        unsigned int dst_len)
+{
+    unsigned int end = (unsigned int) ((((uint64_t) i + 1) * src_len) /
+            dst_len);
+    unsigned int start = _box_start(i, src_len, dst_len);
+
+    return (end <= start) ? start + 1 : end;
+}
+
+
+/* Map destination coordinates [first, first + count) to the source
+ * span [map0, map1) they cover, relative to the first one */
+static void _map_box(unsigned int *map0, unsigned int *map1,
+        unsigned int src_len, unsigned int dst_len,
+        unsigned int first, unsigned int count)
+{
+    unsigned int origin = _box_start(first, src_len, dst_len);
+
+    for (unsigned int i = 0; i < count; ++i) {
+        map0[i] = _box_start(first + i, src_len, dst_len) - origin;
+        map1[i] = _box_end(first + i, src_len, dst_len) - origin;
+    }
+}
+
+
+/* Blend two pixels, two channels per multiplication; weight is 0..256 */
+static inline uint32_t _lerp(uint32_t a, uint32_t b, uint32_t weight)
+{
+    uint32_t rb = (((a & 0x00FF00FFu) * (256u - weight) +
+                (b & 0x00FF00FFu) * weight) >> 8) & 0x00FF00FFu;
+    uint32_t ag = ((((a >> 8) & 0x00FF00FFu) * (256u - weight) +
+                ((b >> 8) & 0x00FF00FFu) * weight)) & 0xFF00FF00u;
+
+    return rb | ag;
+}
+
+
+/* Row kernel: nearest neighbour */
+static void _row_nearest(const uint32_t *restrict src,
+        uint32_t *restrict dst, const unsigned int *restrict map,
+        unsigned int width)
+{
+    for (unsigned int x = 0; x < width; ++x) {
+        dst[x] = src[map[x]];
+    }
+}
+
+
+/* Row kernel: vertical blend of two whole rows */
+static void _row_lerp(const uint32_t *restrict src0,
+        const uint32_t *restrict src1, uint32_t *restrict dst,
+        uint32_t weight, unsigned int width)
+{
+    for (unsigned int x = 0; x < width; ++x) {
+        dst[x] = _lerp(src0[x], src1[x], weight);
+    }
+}
+
+
+/* Row kernel: horizontal blend of mapped pairs of pixels */
+static void _row_bilinear(const uint32_t *restrict src,
+        uint32_t *restrict dst, const unsigned int *restrict map0,
+        const unsigned int *restrict map1,
+        const uint32_t *restrict weight, unsigned int width)
+{
+    for (unsigned int x = 0; x < width; ++x) {
+        dst[x] = _lerp(src[map0[x]], src[map1[x]], weight[x]);
+    }
+}
+
+
+/* Row kernel: add every channel of a row into planar accumulators */
+static void _row_accumulate(const uint32_t *restrict src,
+        uint32_t *restrict acc0, uint32_t *restrict acc1,
+        uint32_t *restrict acc2, uint32_t *restrict acc3,
+        unsigned int width)
+{
+    for (unsigned int x = 0; x < width; ++x) {
+        uint32_t pixel = src[x];
+        acc0[x] += pixel & 0xFF;
+        acc1[x] += (pixel >> 8) & 0xFF;
+        acc2[x] += (pixel >> 16) & 0xFF;
+        acc3[x] += pixel >> 24;
+    }
+}
+
+
+/* Sum a span of an accumulator */
+static uint32_t _span_sum(const uint32_t *restrict acc, unsigned int x0,
+        unsigned int x1)
+{
+    uint32_t sum = 0;
+    for (unsigned int x = x0; x < x1; ++x) {
+        sum += acc[x];
+    }
+    return sum;
+}
+
+
+/* Row kernel: average the accumulated spans of a row */
+static void _row_box(const uint32_t *restrict acc0,
+        const uint32_t *restrict acc1, const uint32_t *restrict acc2,
+        const uint32_t *restrict acc3, uint32_t *restrict dst,
+        const unsigned int *restrict map0,
+        const unsigned int *restrict map1,
+        unsigned int rows, unsigned int width)
+{
+    for (unsigned int x = 0; x < width; ++x) {
+        uint32_t n = (map1[x] - map0[x]) * rows;
+        uint32_t c0 = (_span_sum(acc0, map0[x], map1[x]) + n / 2) / n;
+        uint32_t c1 = (_span_sum(acc1, map0[x], map1[x]) + n / 2) / n;
+        uint32_t c2 = (_span_sum(acc2, map0[x], map1[x]) + n / 2) / n;
+        uint32_t c3 = (_span_sum(acc3, map0[x], map1[x]) + n / 2) / n;
+        dst[x] = c0 | (c1 << 8) | (c2 << 16) | (c3 << 24);
+    }
+}
+
+
+/* Scale using the nearest neighbour */
+static int _scale_nearest(const uint32_t *src, unsigned int src_width,
+        unsigned int src_height, size_t src_stride,
+        uint32_t *dst, unsigned int dst_width,
+        unsigned int dst_height, size_t dst_stride)
+{
+    unsigned int *map_x = malloc(dst_width * sizeof(*map_x));
+    unsigned int *map_y = malloc(dst_height * sizeof(*map_y));
+    if (!map_x || !map_y) {
+        free(map_x);
+        free(map_y);
+        return -1;
+    }
+
+    _map_nearest(map_x, src_width, dst_width);
+    _map_nearest(map_y, src_height, dst_height);
+    for (unsigned int y = 0; y < dst_height; ++y) {
+        _row_nearest(src + map_y[y] * src_stride, dst + y * dst_stride,
+                map_x, dst_width);
+    }
+
+    free(map_x);
+    free(map_y);
+
+    return 0;
+}
+
+
+/* Scale using bilinear interpolation: rows are blended vertically into
+ * a temporary row, which is then blended horizontally */
+static int _scale_bilinear(const uint32_t *src, unsigned int src_width,
+        unsigned int src_height, size_t src_stride,
+        uint32_t *dst, unsigned int dst_width,
+        unsigned int dst_height, size_t dst_stride)
+{
+    unsigned int *map_x0 = malloc(dst_width * sizeof(*map_x0));
+    unsigned int *map_x1 = malloc(dst_width * sizeof(*map_x1));
+    uint32_t *weight_x = malloc(dst_width * sizeof(*weight_x));
+    unsigned int *map_y0 = malloc(dst_height * sizeof(*map_y0));
+    unsigned int *map_y1 = malloc(dst_height * sizeof(*map_y1));
+    uint32_t *weight_y = malloc(dst_height * sizeof(*weight_y));
+    uint32_t *row = malloc(src_width * sizeof(*row));
+    int rc = -1;
+
+    if (map_x0 && map_x1 && weight_x && map_y0 && map_y1 && weight_y &&
+            row) {
+        _map_bilinear(map_x0, map_x1, weight_x, src_width, dst_width);
+        _map_bilinear(map_y0, map_y1, weight_y, src_height, dst_height);
+        for (unsigned int y = 0; y < dst_height; ++y) {
+            _row_lerp(src + map_y0[y] * src_stride,
+                    src + map_y1[y] * src_stride, row, weight_y[y],
+                    src_width);
+            _row_bilinear(row, dst + y * dst_stride, map_x0, map_x1,
+                    weight_x, dst_width);
+        }
+        rc = 0;
+    }
+
+    free(map_x0);
+    free(map_x1);
+    free(weight_x);
+    free(map_y0);
+    free(map_y1);
+    free(weight_y);
+    free(row);
+
+    return rc;
+}
+
+
+/* Average the source area covered by every pixel of a destination
+ * rectangle: source rows are accumulated per channel, then averaged;
+ * the source starts at the first pixel the rectangle covers */
+static int _box_rect(const uint32_t *src, size_t src_stride,
+        unsigned int src_width, unsigned int src_height,
+        uint32_t *dst, size_t dst_stride,
+        unsigned int dst_width, unsigned int dst_height,
+        unsigned int x, unsigned int y,
+        unsigned int width, unsigned int height)
+{
+    unsigned int *map_x0 = malloc(width * sizeof(*map_x0));
+    unsigned int *map_x1 = malloc(width * sizeof(*map_x1));
+    unsigned int *map_y0 = malloc(height * sizeof(*map_y0));
+    unsigned int *map_y1 = malloc(height * sizeof(*map_y1));
+    uint32_t *acc = NULL;
+    int rc = -1;
+
+    if (map_x0 && map_x1 && map_y0 && map_y1) {
+        _map_box(map_x0, map_x1, src_width, dst_width, x, width);
+        _map_box(map_y0, map_y1, src_height, dst_height, y, height);
+        acc = malloc(4 * (size_t) map_x1[width - 1] * sizeof(*acc));
+    }
+    if (acc) {
+        unsigned int span = map_x1[width - 1];
+        uint32_t *acc0 = acc;
+        uint32_t *acc1 = acc0 + span;
+        uint32_t *acc2 = acc1 + span;
+        uint32_t *acc3 = acc2 + span;
+
+        for (unsigned int j = 0; j < height; ++j) {
+            memset(acc, 0, 4 * (size_t) span * sizeof(*acc));
+            for (unsigned int sy = map_y0[j]; sy < map_y1[j]; ++sy) {
+                _row_accumulate(src + sy * src_stride,
+                        acc0, acc1, acc2, acc3, span);
+            }
+            _row_box(acc0, acc1, acc2, acc3,
+                    dst + (y + j) * dst_stride + x,
+                    map_x0, map_x1, map_y1[j] - map_y0[j], width);
+        }
+        rc = 0;
+    }
+
+    free(map_x0);
+    free(map_x1);
+    free(map_y0);
+    free(map_y1);
+    free(acc);
+
+    return rc;
+}
+
+
+/* Scale by averaging the source area covered by every destination
+ * pixel */
+static int _scale_box(const uint32_t *src, unsigned int src_width,
+        unsigned int src_height, size_t src_stride,
+        uint32_t *dst, unsigned int dst_width,
+        unsigned int dst_height, size_t dst_stride)
+{
+    return _box_rect(src, src_stride, src_width, src_height,
+            dst, dst_stride, dst_width, dst_height,
+            0, 0, dst_width, dst_height);
+}
+
+
+/* Source span covered by a span of a box-filtered destination */
+void scale_box_span(unsigned int src_len, unsigned int dst_len,
+        unsigned int first, unsigned int count,
+        unsigned int *src_first, unsigned int *src_count)
+{
+    *src_first = _box_start(first, src_len, dst_len);
+    *src_count = _box_end(first + count - 1, src_len, dst_len) - *src_first;
+}
+
+
+/* Box-filter a rectangle of the destination from its source area */
+int scale_box_rect(const uint32_t *src, size_t src_stride,
+        unsigned int src_width, unsigned int src_height,
+        uint32_t *dst, size_t dst_stride,
+        unsigned int dst_width, unsigned int dst_height,
+        unsigned int x, unsigned int y,
+        unsigned int width, unsigned int height)
+{
+    if (width == 0 || height == 0) {
+        return 0;
+    }
+
+    return _box_rect(src, src_stride, src_width, src_height,
+            dst, dst_stride, dst_width, dst_height, x, y, width, height);
+}
+
+
+/* Get a scaling filter from its name */
+Bool scale_filter_parse(const char *name, scale_filter_td *filter)
+{
+    if (strcmp(name, "nearest") == 0) {
+        *filter = SCALE_NEAREST;
+    } else if (strcmp(name, "bilinear") == 0) {
+        *filter = SCALE_BILINEAR;
+    } else if (strcmp(name, "box") == 0) {
+        *filter = SCALE_BOX;
+    } else {
+        return False;
+    }
+
+    return True;
+}
+
+
+/* Scale a 32-bit per pixel buffer (four 8-bit channels) */
+int scale_rgb32(const uint32_t *src, unsigned int src_width,
+        unsigned int src_height, size_t src_stride,
+        uint32_t *dst, unsigned int dst_width,
+        unsigned int dst_height, size_t dst_stride,
+        scale_filter_td filter)
+{
+    if (src_width == 0 || src_height == 0 ||
+            dst_width == 0 || dst_height == 0) {
+        return 0;
+    }
+
+    /* Same size: plain copy */
+    if (src_width == dst_width && src_height == dst_height) {
+        for (unsigned int y = 0; y < dst_height; ++y) {
+            memcpy(dst + y * dst_stride, src + y * src_stride,
+                    dst_width * sizeof(*dst));
+        }
+        return 0;
+    }
+
+    switch (filter) {
+        case SCALE_BILINEAR:
+            return _scale_bilinear(src, src_width, src_height, src_stride,
+                    dst, dst_width, dst_height, dst_stride);
+        case SCALE_BOX:
+            return _scale_box(src, src_width, src_height, src_stride,
+                    dst, dst_width, dst_height, dst_stride);
+        case SCALE_NEAREST:
+        default:
+            return _scale_nearest(src, src_width, src_height, src_stride,
+                    dst, dst_width, dst_height, dst_stride);
+    }
+}
+
+
+/* Scale a client-side image */
+XImage *image_scale(Display *display, XImage *image,
+        unsigned int width, unsigned int height,
+        scale_filter_td filter)
+{
+    XImage *scaled;
+    unsigned int width_old = (unsigned int) image->width;
+    unsigned int height_old = (unsigned int) image->height;
+
+    /* Let Xlib choose the pixel format that matches the image depth */
+    scaled = XCreateImage(display,
+            DefaultVisual(display, DefaultScreen(display)),
+            (unsigned int) image->depth, ZPixmap, 0, NULL,
+            width, height, 32/*bits*/, 0);
+    if (!scaled) {
+        return NULL;
+    }
+    scaled->data = malloc((size_t) scaled->bytes_per_line * height);
+    if (!scaled->data) {
+        XDestroyImage(scaled);
+        return NULL;
+    }
+
+    /* Fast path: whole rows of 32-bit pixels */
+    if (_image_is_rgb32(image) && _image_is_rgb32(scaled)) {
+        if (scale_rgb32((const uint32_t *) (void *) image->data,
+                    width_old, height_old,
+                    (size_t) image->bytes_per_line / 4,
+                    (uint32_t *) (void *) scaled->data, width, height,
+                    (size_t) scaled->bytes_per_line / 4, filter) == 0) {
+            return scaled;
+        }
+        XDestroyImage(scaled);
+        return NULL;
+    }
+
+    /* Any other visual: nearest neighbour, pixel by pixel */
+    for (unsigned int y = 0; y < height; ++y) {
+        int src_y = (int) ((2 * (uint64_t) y + 1) * height_old /
+                (2 * (uint64_t) height));
+        for (unsigned int x = 0; x < width; ++x) {
+            int src_x = (int) ((2 * (uint64_t) x + 1) * width_old /
+                    (2 * (uint64_t) width));
+            XPutPixel(scaled, (int) x, (int) y,
+                    XGetPixel(image, src_x, src_y));
+        }
+    }
+
+    return scaled;
+}
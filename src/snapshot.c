@@ -0,0 +1,247 @@
+/**
+ * @file snapshot.c
+ *
+ * @brief Thumbnails of the current contents of a window implementation
+ */
+/*
+ * ISC License
+ * Copyright (c) 2025, J. A. Corbal <jacorbal@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS.  IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS
+ * ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF
+ * THIS SOFTWARE.
+ */
+
+/* Standard library includes */
+#include <pthread.h>    /* pthread_create, pthread_join */
+#include <stdlib.h>     /* free, malloc */
+#include <string.h>     /* memset */
+
+/* X includes */
+#include <X11/Xlib.h>                   /* Display, GC, Window, XImage */
+#include <X11/Xutil.h>                  /* XDestroyImage */
+#include <X11/extensions/Xcomposite.h>  /* XComposite* */
+
+/* Local includes */
+#include <render.h>
+#include <scale.h>
+#include <snapshot.h>
+
+
+/* Error handler that ignores errors, while capturing */
+static int _error_ignore(Display *display, XErrorEvent *error)
+{
+    (void) display;
+    (void) error;
+    return 0;
+}
+
+
+/* Whether XComposite can name window pixmaps (version 0.2 or later) */
+static Bool _composite_available(Display *display)
+{
+    int event_base, error_base;
+    int major = 0, minor = 2;
+
+    return XCompositeQueryExtension(display, &event_base, &error_base) &&
+        XCompositeQueryVersion(display, &major, &minor) &&
+        (major > 0 || minor >= 2);
+}
+
+
+/* Reduce the capture to the thumbnail, and announce it */
+static void *_snapshot_reduce(void *data)
+{
+    snapshot_td *snapshot = data;
+    XEvent event;
+
+    if ((unsigned int) snapshot->capture->width == snapshot->width &&
+            (unsigned int) snapshot->capture->height == snapshot->height) {
+        /* Already reduced by the server */
+        snapshot->thumbnail = snapshot->capture;
+    } else {
+        snapshot->thumbnail = image_scale(snapshot->display,
+                snapshot->capture, snapshot->width, snapshot->height,
+                SCALE_BOX);
+        XDestroyImage(snapshot->capture);
+    }
+    snapshot->capture = NULL;
+
+    memset(&event, 0, sizeof(event));
+    event.xclient.type = ClientMessage;
+    event.xclient.window = snapshot->notify;
+    event.xclient.message_type = snapshot->message;
+    event.xclient.format = 32;
+    XSendEvent(snapshot->display, snapshot->notify, False, NoEventMask,
+            &event);
+    XFlush(snapshot->display);
+
+    return NULL;
+}
+
+
+/* Reduce a window pixmap on the server, and read the thumbnail alone */
+static XImage *_capture_reduced(Display *display, Pixmap pixmap,
+        Bool alpha, unsigned int src_width, unsigned int src_height,
+        unsigned int width, unsigned int height)
+{
+    int screen = DefaultScreen(display);
+    Pixmap reduced = XCreatePixmap(display, RootWindow(display, screen),
+            width, height, (unsigned int) DefaultDepth(display, screen));
+
+    /* ARGB windows over black, so that their alpha is ignored, as in a
+     * capture read as is */
+    if (alpha) {
+        GC gc = XCreateGC(display, reduced, 0, NULL);
+        XSetForeground(display, gc, BlackPixel(display, screen));
+        XFillRectangle(display, reduced, gc, 0, 0, width, height);
+        XFreeGC(display, gc);
+    }
+    XImage *image = NULL;
+    if (render_composite(display, pixmap, alpha, src_width, src_height,
+                reduced, 0, 0, width, height, SCALE_BOX)) {
+        image = XGetImage(display, reduced, 0, 0, width, height,
+                AllPlanes, ZPixmap);
+    }
+    XFreePixmap(display, reduced);
+
+    return image;
+}
+
+
+/* Capture the current contents of a window */
+XImage *snapshot_capture(Display *display, Window window,
+        unsigned int width, unsigned int height,
+        unsigned int *src_width, unsigned int *src_height)
+{
+    int (*handler)(Display *, XErrorEvent *);
+    Drawable drawable = window;
+    Pixmap pixmap = None;
+    Window root;
+    int x, y;
+    unsigned int window_width, window_height, border, depth;
+    unsigned int default_depth = (unsigned int) DefaultDepth(display,
+            DefaultScreen(display));
+    XImage *image = NULL;
+
+    /* The window may vanish or be unmapped meanwhile: nothing to do */
+    XSync(display, False);
+    handler = XSetErrorHandler(_error_ignore);
+
+    /* Redirecting again is harmless if a compositor already did it, and
+     * then the pixmap holds the whole window; if not, the server fills
+     * the new pixmap from the screen, obscuring windows included */
+    Bool composite = _composite_available(display);
+    if (composite) {
+        XCompositeRedirectWindow(display, window,
+                CompositeRedirectAutomatic);
+        pixmap = XCompositeNameWindowPixmap(display, window);
+        drawable = pixmap;
+    }
+
+    if (XGetGeometry(display, drawable, &root, &x, &y, &window_width,
+                &window_height, &border, &depth) &&
+            (depth == default_depth || depth == 32)) {
+        *src_width = window_width;
+        *src_height = window_height;
+
+        /* Only the thumbnail crosses the connection, if the server can
+         * reduce the window; or else, the whole window */
+        if (pixmap != None) {
+            image = _capture_reduced(display, pixmap,
+                    (depth == 32 && depth != default_depth),
+                    window_width, window_height, width, height);
+        }
+        if (!image) {
+            image = XGetImage(display, drawable, 0, 0, window_width,
+                    window_height, AllPlanes, ZPixmap);
+        }
+    }
+
+    /* ARGB windows have the same pixel layout; alpha is ignored */
+    if (image && (unsigned int) image->depth != default_depth) {
+        if (image->bits_per_pixel == 32 && default_depth == 24) {
+            image->depth = (int) default_depth;
+        } else {
+            XDestroyImage(image);
+            image = NULL;
+        }
+    }
+
+    if (pixmap != None) {
+        XFreePixmap(display, pixmap);
+    }
+    if (composite) {
+        XCompositeUnredirectWindow(display, window,
+                CompositeRedirectAutomatic);
+    }
+    XSync(display, False);
+    XSetErrorHandler(handler);
+
+    return image;
+}
+
+
+/* Start reducing a capture to a thumbnail */
+snapshot_td *snapshot_start(Display *display, XImage *capture,
+        unsigned int src_width, unsigned int src_height,
+        unsigned int width, unsigned int height,
+        Window notify, Atom message)
+{
+    snapshot_td *snapshot = malloc(sizeof(snapshot_td));
+    if (!snapshot) {
+        XDestroyImage(capture);
+        return NULL;
+    }
+
+    snapshot->display = display;
+    snapshot->notify = notify;
+    snapshot->message = message;
+    snapshot->capture = capture;
+    snapshot->thumbnail = NULL;
+    snapshot->src_width = src_width;
+    snapshot->src_height = src_height;
+    snapshot->width = width;
+    snapshot->height = height;
+
+    /* Nothing left to reduce, if the server did it */
+    snapshot->threaded = ((unsigned int) capture->width != width ||
+            (unsigned int) capture->height != height) &&
+        pthread_create(&snapshot->thread, NULL, _snapshot_reduce,
+                snapshot) == 0;
+    if (!snapshot->threaded) {
+        _snapshot_reduce(snapshot);
+    }
+
+    return snapshot;
+}
+
+
+/* Wait for a snapshot to finish and release it */
+XImage *snapshot_finish(snapshot_td *snapshot,
+        unsigned int *src_width, unsigned int *src_height)
+{
+    if (snapshot->threaded) {
+        pthread_join(snapshot->thread, NULL);
+    }
+    if (src_width) {
+        *src_width = snapshot->src_width;
+    }
+    if (src_height) {
+        *src_height = snapshot->src_height;
+    }
+
+    XImage *thumbnail = snapshot->thumbnail;
+    free(snapshot);
+
+    return thumbnail;
+}
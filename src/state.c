@@ -0,0 +1,374 @@
+/**
+ * @file state.c
+ *
+ * @brief Icons of the daemon, kept across restarts in a mapped file
+ *        implementation
+ */
+/*
+ * ISC License
+ * Copyright (c) 2025, J. A. Corbal <jacorbal@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS.  IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS
+ * ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF
+ * THIS SOFTWARE.
+ */
+
+/* Enable features from the POSIX.1-2008 standard */
+#define _POSIX_C_SOURCE 200809L
+
+/* Standard library includes */
+#include <fcntl.h>      /* open, O_* */
+#include <stddef.h>     /* offsetof, size_t */
+#include <stdint.h>     /* uint32_t, uint64_t, uintptr_t */
+#include <stdio.h>      /* snprintf */
+#include <stdlib.h>     /* getenv */
+#include <string.h>     /* memcmp, memcpy, memset, strlen */
+#include <sys/mman.h>   /* mmap, msync, munmap, MS_* */
+#include <sys/stat.h>   /* fstat */
+#include <unistd.h>     /* close, ftruncate, sysconf */
+
+/* X includes */
+#include <X11/Xlib.h>   /* Bool, False, True, Window */
+
+/* Local includes */
+#include <cache.h>
+#include <defaults.h>
+#include <iconify.h>
+#include <state.h>
+
+
+/* File format */
+#define STATE_MAGIC "ICNSTATE"
+#define STATE_VERSION (3)  /* 3: two copies per slot; icon source */
+#define STATE_FILE_NAME "state"     /* <name>-<display> */
+
+
+/**
+ * @typedef state_header_td
+ *
+ * @brief Header of the file, followed by every slot
+ */
+typedef struct {
+    char magic[8];              /**< @c STATE_MAGIC */
+    uint32_t version;           /**< @c STATE_VERSION */
+    uint32_t slot_count;        /**< @c STATE_SLOTS */
+    uint32_t record_size;       /**< Size of a record (bytes) */
+    uint32_t reserved;          /**< Always 0 */
+} state_header_td;
+
+
+/**
+ * @typedef state_slot_td
+ *
+ * @brief Slot of a record: two copies, each write going to the older
+ */
+typedef struct {
+    state_record_td copies[2];  /**< Copies of the record */
+} state_slot_td;
+
+
+/* File mapped, if any, and its slots */
+static unsigned char *_mapping = NULL;
+static state_slot_td *_slots = NULL;
+
+
+/* Size of the file */
+static inline size_t _file_size(void)
+{
+    return sizeof(state_header_td) +
+        (size_t) STATE_SLOTS * sizeof(state_slot_td);
+}
+
+
+/* Hash (FNV-1a, 64 bits) of a byte sequence, continuing a hash */
+static uint64_t _hash(uint64_t hash, const void *data, size_t length)
+{
+    const unsigned char *bytes = data;
+    for (size_t i = 0; i < length; ++i) {
+        hash = (hash ^ bytes[i]) * 0x100000001B3ull;
+    }
+    return hash;
+}
+
+
+/* Checksum of a record: every field but the checksum itself */
+static inline uint64_t _checksum(const state_record_td *record)
+{
+    return _hash(0xCBF29CE484222325ull, record,
+            offsetof(state_record_td, checksum));
+}
+
+
+/* Whether a copy of a record is whole, and not free */
+static inline Bool _whole(const state_record_td *record)
+{
+    return (record->window != 0 &&
+            record->checksum == _checksum(record)) ? True : False;
+}
+
+
+/* Copy holding the record of a slot: the whole one written last, or -1
+ * if the slot is free */
+static int _newest(const state_slot_td *slot)
+{
+    int newest = -1;
+
+    for (int i = 0; i < 2; ++i) {
+        if (_whole(&slot->copies[i]) && (newest < 0 ||
+                    slot->copies[i].generation >
+                    slot->copies[newest].generation)) {
+            newest = i;
+        }
+    }
+
+    return newest;
+}
+
+
+/* Get the path of the state file of the current display */
+static int _state_path(char *buffer, size_t size)
+{
+    char directory[MAX_PATH_LENGTH];
+    char display_name[64];
+    const char *display_env = getenv("DISPLAY");
+
+    if (cache_directory(directory, sizeof(directory), True) != 0) {
+        return -1;
+    }
+
+    /* Keep only the safe characters of the display name */
+    snprintf(display_name, sizeof(display_name), "%s",
+            (display_env) ? display_env : "");
+    for (char *c = display_name; *c; ++c) {
+        if (*c == '/' || *c == ':') {
+            *c = '_';
+        }
+    }
+    int length = snprintf(buffer, size, "%s/%s-%s", directory,
+            STATE_FILE_NAME, display_name);
+
+    return (length < 0 || (size_t) length >= size) ? -1 : 0;
+}
+
+
+/* Let the kernel write a part of the mapping back, without waiting */
+static void _sync(const void *address, size_t length)
+{
+    uintptr_t page = (uintptr_t) sysconf(_SC_PAGESIZE);
+    uintptr_t start = (uintptr_t) address & ~(page - 1);
+
+    msync((void *) start, (uintptr_t) address + length - start,
+            MS_ASYNC);
+}
+
+
+/* Map the state file of the current display */
+int state_open(void)
+{
+    char path[MAX_PATH_LENGTH];
+    struct stat status;
+    size_t size = _file_size();
+
+    if (_mapping) {
+        return 0;
+    }
+    if (_state_path(path, sizeof(path)) != 0) {
+        return -1;
+    }
+    int fd = open(path, O_RDWR | O_CREAT, 0600);
+    if (fd < 0) {
+        return -1;
+    }
+    if (fstat(fd, &status) != 0 || ((size_t) status.st_size != size &&
+                ftruncate(fd, (off_t) size) != 0)) {
+        close(fd);
+        return -1;
+    }
+    void *mapping = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED,
+            fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED) {
+        return -1;
+    }
+    _mapping = mapping;
+    _slots = (state_slot_td *) (void *)
+        (_mapping + sizeof(state_header_td));
+
+    /* A file of another version, or of nothing yet: start empty */
+    state_header_td header;
+    memcpy(&header, _mapping, sizeof(header));
+    if (memcmp(header.magic, STATE_MAGIC, sizeof(header.magic)) != 0 ||
+            header.version != STATE_VERSION ||
+            header.slot_count != STATE_SLOTS ||
+            header.record_size != sizeof(state_record_td)) {
+        memset(_mapping, 0, size);
+        memset(&header, 0, sizeof(header));
+        memcpy(header.magic, STATE_MAGIC, sizeof(header.magic));
+        header.version = STATE_VERSION;
+        header.slot_count = STATE_SLOTS;
+        header.record_size = sizeof(state_record_td);
+        memcpy(_mapping, &header, sizeof(header));
+        _sync(_mapping, size);
+        return 0;
+    }
+
+    /* Copies left half written are cleared; the other copy of their
+     * slot, if whole, is still its record */
+    for (unsigned int i = 0; i < STATE_SLOTS; ++i) {
+        for (int j = 0; j < 2; ++j) {
+            state_record_td *copy = &_slots[i].copies[j];
+            if (copy->window != 0 && !_whole(copy)) {
+                memset(copy, 0, sizeof(*copy));
+                _sync(copy, sizeof(*copy));
+            }
+        }
+    }
+
+    return 0;
+}
+
+
+/* Unmap the state file; the records are left in it */
+void state_close(void)
+{
+    if (_mapping) {
+        msync(_mapping, _file_size(), MS_SYNC);
+        munmap(_mapping, _file_size());
+        _mapping = NULL;
+        _slots = NULL;
+    }
+}
+
+
+/* Get a record of the state file */
+Bool state_get(unsigned int slot, state_record_td *record)
+{
+    if (!_slots || slot >= STATE_SLOTS) {
+        return False;
+    }
+    int newest = _newest(&_slots[slot]);
+    if (newest < 0) {
+        return False;
+    }
+    memcpy(record, &_slots[slot].copies[newest], sizeof(*record));
+
+    return True;
+}
+
+
+/* Hash of the class and name of a window */
+uint64_t state_class_key(const char *res_class, const char *res_name)
+{
+    uint64_t hash = 0xCBF29CE484222325ull;
+
+    /* Terminators included, so that the two strings cannot run into
+     * each other */
+    hash = _hash(hash, (res_class) ? res_class : "",
+            (res_class) ? strlen(res_class) + 1 : 1);
+    hash = _hash(hash, (res_name) ? res_name : "",
+            (res_name) ? strlen(res_name) + 1 : 1);
+
+    return hash;
+}
+
+
+/* Slot of the record of a window, or -1 if it has none; or the first
+ * free slot, for @c None */
+static int _slot_find(Window window)
+{
+    for (unsigned int i = 0; i < STATE_SLOTS; ++i) {
+        int newest = _newest(&_slots[i]);
+        uint64_t owner = (newest < 0) ? 0 :
+            _slots[i].copies[newest].window;
+        if (owner == (uint64_t) window) {
+            return (int) i;
+        }
+    }
+
+    return -1;
+}
+
+
+/* Write the record of an icon, over the older copy of its slot */
+void state_save(const icon_td *icon)
+{
+    state_record_td record;
+
+    if (!_slots) {
+        return;
+    }
+    if (strlen(icon->path) >= sizeof(record.path)) {
+        state_forget(icon->window_orig);
+        return;
+    }
+
+    /* Cleared first, so that the padding does not change the checksum */
+    memset(&record, 0, sizeof(record));
+    record.window = (uint64_t) icon->window_orig;
+    record.class_key = state_class_key(icon->res_class, icon->res_name);
+    record.source_key = icon->source_key;
+    record.x = icon->x_pos;
+    record.y = icon->y_pos;
+    record.x_anchor = icon->place.x_anchor;
+    record.y_anchor = icon->place.y_anchor;
+    record.orig_x = icon->orig_x;
+    record.orig_y = icon->orig_y;
+    record.border = icon->border;
+    record.width = icon->width;
+    record.height = icon->height;
+    record.bg = (uint32_t) icon->bg;
+    record.fg = (uint32_t) icon->fg;
+    record.fc = (uint32_t) icon->fc;
+    record.live_rate = icon->live_rate;
+    record.show_text = (icon->show_text) ? 1 : 0;
+    record.snapshot = (icon->snapshot) ? 1 : 0;
+    record.filter = (uint8_t) icon->filter;
+    record.source = (uint8_t) icon->source;
+    snprintf(record.name, sizeof(record.name), "%s", icon->prog_name);
+    snprintf(record.group, sizeof(record.group), "%s",
+            (icon->group) ? icon->group : "");
+    snprintf(record.path, sizeof(record.path), "%s", icon->path);
+
+    /* Its own slot, or else the first free one */
+    int slot = _slot_find(icon->window_orig);
+    if (slot < 0) {
+        slot = _slot_find(None);
+    }
+    if (slot < 0) {
+        return;     /* Every slot is taken: this icon is not kept */
+    }
+
+    /* Over the other copy than the record, one generation after it */
+    state_slot_td *target = &_slots[slot];
+    int newest = _newest(target);
+    state_record_td *copy = &target->copies[(newest == 0) ? 1 : 0];
+    record.generation = (newest < 0) ? 1 :
+        target->copies[newest].generation + 1;
+    record.checksum = _checksum(&record);
+    memcpy(copy, &record, sizeof(record));
+    _sync(copy, sizeof(record));
+}
+
+
+/* Clear the record of a window, if any */
+void state_forget(Window window)
+{
+    if (!_slots || window == None) {
+        return;
+    }
+
+    int slot = _slot_find(window);
+    if (slot >= 0) {
+        memset(&_slots[slot], 0, sizeof(_slots[slot]));
+        _sync(&_slots[slot], sizeof(_slots[slot]));
+    }
+}
@@ -0,0 +1,853 @@
+/**
+ * @file theme.c
+ *
+ * @brief Icon lookup by name in the icon themes, through an index
+ *        implementation
+ */
+/*
+ * ISC License
+ * Copyright (c) 2025, J. A. Corbal <jacorbal@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS.  IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS
+ * ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF
+ * THIS SOFTWARE.
+ */
+
+/* Enable features from the POSIX.1-2008 standard */
+#define _POSIX_C_SOURCE 200809L
+
+/* Standard library includes */
+#include <ctype.h>          /* isdigit, isspace, tolower */
+#include <dirent.h>         /* DIR, closedir, dirfd, opendir, ... */
+#include <fcntl.h>          /* AT_FDCWD, open, O_* */
+#include <stdint.h>         /* uint16_t, uint32_t, uint64_t */
+#include <stdio.h>          /* FILE, fclose, fgets, fopen, snprintf */
+#include <stdlib.h>         /* free, getenv, malloc, realloc */
+#include <string.h>         /* memcmp, memcpy, strchr, strlen, ... */
+#include <strings.h>        /* strcasecmp */
+#include <sys/inotify.h>    /* inotify_add_watch, inotify_init1, IN_* */
+#include <sys/mman.h>       /* mmap, munmap */
+#include <sys/stat.h>       /* fstat, stat, utimensat */
+#include <time.h>           /* time, time_t */
+#include <unistd.h>         /* close, getpid, read, rename, unlink, write */
+
+/* X includes */
+#include <X11/Xlib.h>       /* Bool, False, True */
+
+/* Local includes */
+#include <cache.h>
+#include <defaults.h>
+#include <theme.h>
+
+
+/* Index format */
+#define THEME_MAGIC "ICNTHEME"
+#define THEME_VERSION (2)
+#define THEME_INDEX_NAME "theme.index"
+
+/* Most directories searched for themes, and most themes */
+#define THEME_MAX_BASES (16)
+#define THEME_MAX_ROOTS (3 * THEME_MAX_BASES)
+
+/* Least time between two checks of every directory walked, by any
+ * process (s); the theme roots are checked on every run */
+#define THEME_CHECK_INTERVAL (300)
+
+/* Levels of directories walked below a theme: '<size>/<context>' or
+ * '<context>/<size>', and one more for '@2x' and alike */
+#define THEME_MAX_DEPTH (3)
+
+/* Changes to watch in the theme directories */
+#define THEME_WATCH_MASK (IN_CREATE | IN_DELETE | IN_MOVED_FROM | \
+        IN_MOVED_TO | IN_CLOSE_WRITE | IN_DELETE_SELF | IN_ATTRIB)
+
+
+/**
+ * @typedef theme_header_td
+ *
+ * @brief Header of the index, followed by the hash buckets, the
+ *        directories walked, the entries and the strings
+ */
+typedef struct {
+    char magic[8];              /**< @c THEME_MAGIC */
+    uint32_t version;           /**< @c THEME_VERSION */
+    uint32_t bucket_count;      /**< Number of buckets, a power of two */
+    uint32_t entry_count;       /**< Number of entries */
+    uint32_t strings_size;      /**< Size of the strings (bytes) */
+    uint32_t dir_count;         /**< Number of directories walked */
+    uint64_t stamp;             /**< Hash of the themes searched */
+} theme_header_td;
+
+/**
+ * @typedef theme_dir_td
+ *
+ * @brief Directory walked, as it was then
+ *
+ * @note Files added to or removed from a directory only change its own
+ *       modification time, and not the one of the theme above it
+ */
+typedef struct {
+    int64_t mtime_sec;          /**< Modification time (s) */
+    uint32_t mtime_nsec;        /**< Modification time (ns) */
+    uint32_t path;              /**< Offset of the directory path */
+} theme_dir_td;
+
+/**
+ * @typedef theme_entry_td
+ *
+ * @brief Icon file in the index
+ *
+ * @note Buckets hold the first entry of their chain, plus one; chains
+ *       keep the order of the search, so the first of equals wins
+ */
+typedef struct {
+    uint32_t hash;              /**< Hash of the lowercase name */
+    uint32_t next;              /**< Next entry in the chain, plus one */
+    uint32_t name;              /**< Offset of the lowercase name */
+    uint32_t path;              /**< Offset of the file path */
+    uint16_t size;              /**< Size of its directory (px), or 0 */
+    uint16_t rank;              /**< 0: user theme, 1: hicolor, 2: rest */
+} theme_entry_td;
+
+/**
+ * @typedef theme_root_td
+ *
+ * @brief Directory to search for icons
+ */
+typedef struct {
+    char path[MAX_PATH_LENGTH]; /**< Directory path */
+    unsigned int rank;          /**< Rank of its icons */
+    unsigned int depth;         /**< Levels of subdirectories to walk */
+} theme_root_td;
+
+/**
+ * @typedef theme_builder_td
+ *
+ * @brief Index being built
+ */
+typedef struct {
+    theme_entry_td *entries;    /**< Entries, in the search order */
+    size_t count;               /**< Number of entries */
+    size_t capacity;            /**< Room for entries */
+    theme_dir_td *dirs;         /**< Directories walked */
+    size_t dir_count;           /**< Number of directories */
+    size_t dir_capacity;        /**< Room for directories */
+    char *strings;              /**< Names and paths */
+    size_t strings_size;        /**< Size of the strings (bytes) */
+    size_t strings_capacity;    /**< Room for strings (bytes) */
+} theme_builder_td;
+
+
+/* Index in use, mapped from its file or else allocated */
+static unsigned char *_index = NULL;
+static size_t _index_size = 0;
+static Bool _index_mapped = False;
+static time_t _index_time = 0;      /* Written, or last checked */
+
+/* Changes watched, and whether the index has to be rebuilt */
+static int _watch_fd = -1;
+static Bool _stale = False;
+
+
+/* Hash (FNV-1a, 32 bits) of a name, ignoring case */
+static uint32_t _name_hash(const char *name)
+{
+    uint32_t hash = 0x811C9DC5u;
+    for (const unsigned char *c = (const unsigned char *) name; *c; ++c) {
+        hash = (hash ^ (uint32_t) tolower(*c)) * 0x01000193u;
+    }
+    return hash;
+}
+
+
+/* Hash (FNV-1a, 64 bits) of a byte sequence, continuing a hash */
+static uint64_t _hash(uint64_t hash, const void *data, size_t length)
+{
+    const unsigned char *bytes = data;
+    for (size_t i = 0; i < length; ++i) {
+        hash = (hash ^ bytes[i]) * 0x100000001B3ull;
+    }
+    return hash;
+}
+
+
+/* Get the icon theme chosen for GTK, if any */
+static Bool _user_theme(char *name, size_t size)
+{
+    const char *config_home = getenv("XDG_CONFIG_HOME");
+    const char *home = getenv("HOME");
+    char path[MAX_PATH_LENGTH];
+    char line[256];
+    Bool found = False;
+
+    if (config_home && config_home[0] == '/') {
+        snprintf(path, sizeof(path), "%s/gtk-3.0/settings.ini",
+                config_home);
+    } else if (home && home[0] == '/') {
+        snprintf(path, sizeof(path), "%s/.config/gtk-3.0/settings.ini",
+                home);
+    } else {
+        return False;
+    }
+
+    FILE *fp = fopen(path, "r");
+    if (!fp) {
+        return False;
+    }
+    while (!found && fgets(line, sizeof(line), fp)) {
+        char *c = line;
+        while (isspace((unsigned char) *c)) {
+            ++c;
+        }
+        if (strncmp(c, "gtk-icon-theme-name", 19) != 0) {
+            continue;
+        }
+        for (c += 19; isspace((unsigned char) *c); ++c) {
+            /* Skip it */
+        }
+        if (*c++ != '=') {
+            continue;
+        }
+        while (isspace((unsigned char) *c) || *c == '"') {
+            ++c;
+        }
+        size_t length = strcspn(c, "\"\r\n");
+        while (length > 0 && isspace((unsigned char) c[length - 1])) {
+            --length;
+        }
+        if (length > 0 && strchr(c, '/') == NULL) {
+            snprintf(name, size, "%.*s", (int) length, c);
+            found = True;
+        }
+    }
+    fclose(fp);
+
+    return found;
+}
+
+
+/* Get the directories where themes are searched, in order */
+static size_t _bases_get(char bases[][MAX_PATH_LENGTH], size_t max)
+{
+    const char *data_home = getenv("XDG_DATA_HOME");
+    const char *data_dirs = getenv("XDG_DATA_DIRS");
+    const char *home = getenv("HOME");
+    size_t count = 0;
+
+    if (data_home && data_home[0] == '/') {
+        snprintf(bases[count++], MAX_PATH_LENGTH, "%s/icons", data_home);
+    } else if (home && home[0] == '/') {
+        snprintf(bases[count++], MAX_PATH_LENGTH, "%s/.local/share/icons",
+                home);
+    }
+    if (home && home[0] == '/') {
+        snprintf(bases[count++], MAX_PATH_LENGTH, "%s/.icons", home);
+    }
+    if (!data_dirs || data_dirs[0] == '\0') {
+        data_dirs = "/usr/local/share:/usr/share";
+    }
+    while (*data_dirs && count < max) {
+        size_t length = strcspn(data_dirs, ":");
+        if (length > 0 && data_dirs[0] == '/') {
+            snprintf(bases[count++], MAX_PATH_LENGTH, "%.*s/icons",
+                    (int) length, data_dirs);
+        }
+        data_dirs += length + (data_dirs[length] == ':');
+    }
+
+    return count;
+}
+
+
+/* Get the directories to search for icons, in order, and the hash of
+ * their names and modification times */
+static size_t _roots_get(theme_root_td *roots, size_t max,
+        uint64_t *stamp)
+{
+    char bases[THEME_MAX_BASES][MAX_PATH_LENGTH];
+    char user[128];
+    const char *themes[2] = { NULL, "hicolor" };
+    uint32_t version = THEME_VERSION;
+    size_t count = 0;
+    struct stat status;
+
+    if (_user_theme(user, sizeof(user)) && strcmp(user, "hicolor") != 0) {
+        themes[0] = user;
+    }
+    size_t base_count = _bases_get(bases, THEME_MAX_BASES);
+    for (unsigned int rank = 0; rank < 2; ++rank) {
+        for (size_t i = 0; themes[rank] && i < base_count &&
+                count < max; ++i) {
+            if (snprintf(roots[count].path, MAX_PATH_LENGTH, "%s/%s",
+                        bases[i], themes[rank]) >= MAX_PATH_LENGTH) {
+                continue;   /* Too long to be opened anyway */
+            }
+            roots[count].rank = rank;
+            roots[count++].depth = THEME_MAX_DEPTH;
+        }
+    }
+    if (count < max) {
+        snprintf(roots[count].path, MAX_PATH_LENGTH, "/usr/share/pixmaps");
+        roots[count].rank = 2;
+        roots[count++].depth = 0;
+    }
+
+    /* Any theme created or removed changes it; the directories below
+     * are checked one by one (see '_index_fresh') */
+    *stamp = _hash(0xCBF29CE484222325ull, &version, sizeof(version));
+    for (size_t i = 0; i < count; ++i) {
+        int64_t mtime[2] = { -1, -1 };
+        if (stat(roots[i].path, &status) == 0) {
+            mtime[0] = (int64_t) status.st_mtim.tv_sec;
+            mtime[1] = (int64_t) status.st_mtim.tv_nsec;
+        }
+        *stamp = _hash(*stamp, roots[i].path, strlen(roots[i].path) + 1);
+        *stamp = _hash(*stamp, mtime, sizeof(mtime));
+    }
+
+    return count;
+}
+
+
+/* Size of the icons of a directory named '<size>', '<size>x<size>' or
+ * '<size>x<size>@<scale>', or else the inherited one */
+static unsigned int _directory_size(const char *name, unsigned int size)
+{
+    unsigned long value = 0;
+    const char *c = name;
+
+    if (!isdigit((unsigned char) *c)) {
+        return size;
+    }
+    while (isdigit((unsigned char) *c)) {
+        value = value * 10 + (unsigned long) (*c++ - '0');
+        if (value > UINT16_MAX) {
+            return size;
+        }
+    }
+    if (*c == 'x') {
+        for (++c; isdigit((unsigned char) *c); ++c) {
+            /* Skip it */
+        }
+    }
+
+    return (*c == '\0' || *c == '@') ? (unsigned int) value : size;
+}
+
+
+/* Add a string to the index being built; returns its offset */
+static long _string_add(theme_builder_td *builder, const char *string,
+        size_t length, Bool lower)
+{
+    if (builder->strings_size + length + 1 > builder->strings_capacity) {
+        size_t capacity = (builder->strings_capacity) ?
+            2 * builder->strings_capacity : 65536;
+        while (capacity < builder->strings_size + length + 1) {
+            capacity *= 2;
+        }
+        char *strings = (capacity <= UINT32_MAX) ?
+            realloc(builder->strings, capacity) : NULL;
+        if (!strings) {
+            return -1;
+        }
+        builder->strings = strings;
+        builder->strings_capacity = capacity;
+    }
+
+    long offset = (long) builder->strings_size;
+    char *dst = builder->strings + builder->strings_size;
+    for (size_t i = 0; i < length; ++i) {
+        dst[i] = (lower) ? (char) tolower((unsigned char) string[i]) :
+            string[i];
+    }
+    dst[length] = '\0';
+    builder->strings_size += length + 1;
+
+    return offset;
+}
+
+
+/* Add an icon file to the index being built */
+static void _entry_add(theme_builder_td *builder, const char *name,
+        size_t name_length, const char *path, unsigned int size,
+        unsigned int rank)
+{
+    if (builder->count == builder->capacity) {
+        size_t capacity = (builder->capacity) ? 2 * builder->capacity : 1024;
+        theme_entry_td *entries = realloc(builder->entries,
+                capacity * sizeof(*entries));
+        if (!entries) {
+            return;
+        }
+        builder->entries = entries;
+        builder->capacity = capacity;
+    }
+
+    long name_offset = _string_add(builder, name, name_length, True);
+    long path_offset = _string_add(builder, path, strlen(path), False);
+    if (name_offset < 0 || path_offset < 0) {
+        return;
+    }
+
+    theme_entry_td *entry = &builder->entries[builder->count++];
+    entry->hash = _name_hash(builder->strings + name_offset);
+    entry->next = 0;
+    entry->name = (uint32_t) name_offset;
+    entry->path = (uint32_t) path_offset;
+    entry->size = (uint16_t) size;
+    entry->rank = (uint16_t) rank;
+}
+
+
+/* Add a directory walked to the index being built */
+static void _dir_add(theme_builder_td *builder, const char *path,
+        const struct stat *status)
+{
+    if (builder->dir_count == builder->dir_capacity) {
+        size_t capacity = (builder->dir_capacity) ?
+            2 * builder->dir_capacity : 256;
+        theme_dir_td *dirs = realloc(builder->dirs,
+                capacity * sizeof(*dirs));
+        if (!dirs) {
+            return;
+        }
+        builder->dirs = dirs;
+        builder->dir_capacity = capacity;
+    }
+
+    long path_offset = _string_add(builder, path, strlen(path), False);
+    if (path_offset < 0) {
+        return;
+    }
+
+    theme_dir_td *dir = &builder->dirs[builder->dir_count++];
+    dir->mtime_sec = (int64_t) status->st_mtim.tv_sec;
+    dir->mtime_nsec = (uint32_t) status->st_mtim.tv_nsec;
+    dir->path = (uint32_t) path_offset;
+}
+
+
+/* Walk a directory, adding every icon file that can be read */
+static void _directory_walk(theme_builder_td *builder, const char *dir,
+        unsigned int depth, unsigned int size, unsigned int rank)
+{
+    char path[MAX_PATH_LENGTH];
+    struct dirent *entry;
+    struct stat status;
+
+    DIR *d = opendir(dir);
+    if (!d) {
+        return;
+    }
+    if (_watch_fd >= 0) {
+        inotify_add_watch(_watch_fd, dir, THEME_WATCH_MASK);
+    }
+
+    /* As it is before reading it: a later change is a newer time */
+    if (fstat(dirfd(d), &status) == 0) {
+        _dir_add(builder, dir, &status);
+    }
+
+    while ((entry = readdir(d))) {
+        const char *name = entry->d_name;
+        const char *dot = strrchr(name, '.');
+        if (name[0] == '.' ||
+                snprintf(path, sizeof(path), "%s/%s", dir, name) >=
+                    (int) sizeof(path) ||
+                stat(path, &status) != 0) {
+            continue;
+        }
+        if (S_ISDIR(status.st_mode) && depth > 0) {
+            _directory_walk(builder, path, depth - 1,
+                    _directory_size(name, size), rank);
+        } else if (S_ISREG(status.st_mode) && dot &&
+                (strcmp(dot, ".xpm") == 0 || strcmp(dot, ".xbm") == 0)) {
+            _entry_add(builder, name, (size_t) (dot - name), path, size,
+                    rank);
+        }
+    }
+    closedir(d);
+}
+
+
+/* Lay the index out in a single buffer */
+static unsigned char *_index_serialize(theme_builder_td *builder,
+        uint64_t stamp, size_t *size)
+{
+    theme_header_td header;
+    uint32_t bucket_count = 16;
+
+    while (bucket_count < 2 * builder->count && bucket_count < (1u << 30)) {
+        bucket_count *= 2;
+    }
+    size_t buckets_size = bucket_count * sizeof(uint32_t);
+    size_t dirs_size = builder->dir_count * sizeof(theme_dir_td);
+    size_t entries_size = builder->count * sizeof(theme_entry_td);
+    *size = sizeof(header) + buckets_size + dirs_size + entries_size +
+        builder->strings_size;
+
+    unsigned char *buffer = malloc(*size);
+    if (!buffer) {
+        return NULL;
+    }
+    uint32_t *buckets = (uint32_t *) (buffer + sizeof(header));
+    theme_dir_td *dirs = (theme_dir_td *) (buffer + sizeof(header) +
+            buckets_size);
+    theme_entry_td *entries = (theme_entry_td *) ((unsigned char *) dirs +
+            dirs_size);
+
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, THEME_MAGIC, sizeof(header.magic));
+    header.version = THEME_VERSION;
+    header.bucket_count = bucket_count;
+    header.entry_count = (uint32_t) builder->count;
+    header.strings_size = (uint32_t) builder->strings_size;
+    header.dir_count = (uint32_t) builder->dir_count;
+    header.stamp = stamp;
+    memcpy(buffer, &header, sizeof(header));
+    memset(buckets, 0, buckets_size);
+    if (builder->dir_count > 0) {
+        memcpy(dirs, builder->dirs, dirs_size);
+    }
+    if (builder->count > 0) {
+        memcpy(entries, builder->entries, entries_size);
+    }
+    if (builder->strings_size > 0) {
+        memcpy((unsigned char *) entries + entries_size, builder->strings,
+                builder->strings_size);
+    }
+
+    /* Chain from the last to the first, so chains keep the order */
+    for (size_t i = builder->count; i > 0; --i) {
+        uint32_t bucket = entries[i - 1].hash & (bucket_count - 1);
+        entries[i - 1].next = buckets[bucket];
+        buckets[bucket] = (uint32_t) i;
+    }
+
+    return buffer;
+}
+
+
+/* Check that an index is complete and was made for these themes */
+static Bool _index_check(const unsigned char *index, size_t size,
+        uint64_t stamp)
+{
+    theme_header_td header;
+
+    if (size < sizeof(header)) {
+        return False;
+    }
+    memcpy(&header, index, sizeof(header));
+
+    return memcmp(header.magic, THEME_MAGIC, sizeof(header.magic)) == 0 &&
+        header.version == THEME_VERSION && header.stamp == stamp &&
+        header.bucket_count > 0 &&
+        (header.bucket_count & (header.bucket_count - 1)) == 0 &&
+        size == sizeof(header) +
+            (size_t) header.bucket_count * sizeof(uint32_t) +
+            (size_t) header.dir_count * sizeof(theme_dir_td) +
+            (size_t) header.entry_count * sizeof(theme_entry_td) +
+            header.strings_size &&
+        (header.strings_size == 0 || index[size - 1] == '\0');
+}
+
+
+/* Entries of the index in use, after its buckets and directories */
+static const theme_entry_td *_index_entries(const theme_header_td *header)
+{
+    return (const theme_entry_td *) (_index + sizeof(*header) +
+            (size_t) header->bucket_count * sizeof(uint32_t) +
+            (size_t) header->dir_count * sizeof(theme_dir_td));
+}
+
+
+/* Whether every directory walked for the index in use is still as it
+ * was; themes are not watched outside the daemon.  This is a 'stat' per
+ * directory, hundreds of them, so it is only done once in a while (see
+ * '_index_open') */
+static Bool _index_fresh(void)
+{
+    theme_header_td header;
+    struct stat status;
+
+    memcpy(&header, _index, sizeof(header));
+    const theme_dir_td *dirs = (const theme_dir_td *) (_index +
+            sizeof(header) + (size_t) header.bucket_count * sizeof(uint32_t));
+    const char *strings = (const char *) (_index_entries(&header) +
+            header.entry_count);
+    for (uint32_t i = 0; i < header.dir_count; ++i) {
+        if (dirs[i].path >= header.strings_size ||
+                stat(strings + dirs[i].path, &status) != 0 ||
+                (int64_t) status.st_mtim.tv_sec != dirs[i].mtime_sec ||
+                (uint32_t) status.st_mtim.tv_nsec != dirs[i].mtime_nsec) {
+            return False;
+        }
+    }
+
+    return True;
+}
+
+
+/* Get the path of the index file */
+static int _index_path(char *buffer, size_t size, Bool create)
+{
+    char directory[MAX_PATH_LENGTH];
+
+    if (cache_directory(directory, sizeof(directory), create) != 0) {
+        return -1;
+    }
+    int length = snprintf(buffer, size, "%s/%s", directory,
+            THEME_INDEX_NAME);
+
+    return (length < 0 || (size_t) length >= size) ? -1 : 0;
+}
+
+
+/* Map the index file, if still valid */
+static Bool _index_map(uint64_t stamp)
+{
+    char path[MAX_PATH_LENGTH];
+    struct stat status;
+
+    if (_index_path(path, sizeof(path), False) != 0) {
+        return False;
+    }
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return False;
+    }
+    if (fstat(fd, &status) != 0 || status.st_size <= 0) {
+        close(fd);
+        return False;
+    }
+
+    size_t size = (size_t) status.st_size;
+    void *mapping = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED) {
+        return False;
+    }
+    if (!_index_check(mapping, size, stamp)) {
+        munmap(mapping, size);
+        return False;
+    }
+    _index = mapping;
+    _index_size = size;
+    _index_mapped = True;
+    _index_time = status.st_mtim.tv_sec;
+
+    return True;
+}
+
+
+/* Write the index file, so that other runs can map it */
+static void _index_write(const unsigned char *index, size_t size)
+{
+    char path[MAX_PATH_LENGTH];
+    char temporary[MAX_PATH_LENGTH + 32];
+
+    if (_index_path(path, sizeof(path), True) != 0) {
+        return;
+    }
+    snprintf(temporary, sizeof(temporary), "%s.%ld", path,
+            (long) getpid());
+    int fd = open(temporary, O_WRONLY | O_CREAT | O_TRUNC, 0600);
+    if (fd < 0) {
+        return;
+    }
+    Bool written = write(fd, index, size) == (ssize_t) size;
+    if (close(fd) != 0 || !written || rename(temporary, path) != 0) {
+        unlink(temporary);
+    }
+}
+
+
+/* Release the index in use */
+static void _index_free(void)
+{
+    if (_index && _index_mapped) {
+        munmap(_index, _index_size);
+    } else {
+        free(_index);
+    }
+    _index = NULL;
+    _index_size = 0;
+    _index_mapped = False;
+}
+
+
+/* Walk every theme directory, and build the index of their icons */
+static void _index_build(void)
+{
+    theme_root_td roots[THEME_MAX_ROOTS];
+    theme_builder_td builder;
+    uint64_t stamp;
+
+    memset(&builder, 0, sizeof(builder));
+    size_t count = _roots_get(roots, THEME_MAX_ROOTS, &stamp);
+
+    /* Themes created later must be seen too */
+    if (_watch_fd >= 0) {
+        char bases[THEME_MAX_BASES][MAX_PATH_LENGTH];
+        size_t base_count = _bases_get(bases, THEME_MAX_BASES);
+        for (size_t i = 0; i < base_count; ++i) {
+            inotify_add_watch(_watch_fd, bases[i], THEME_WATCH_MASK);
+        }
+    }
+    for (size_t i = 0; i < count; ++i) {
+        _directory_walk(&builder, roots[i].path, roots[i].depth, 0,
+                roots[i].rank);
+    }
+
+    size_t size;
+    unsigned char *index = _index_serialize(&builder, stamp, &size);
+    free(builder.entries);
+    free(builder.dirs);
+    free(builder.strings);
+    if (!index) {
+        return;
+    }
+
+    /* Mapped from its file, once written, as other runs will */
+    _index_write(index, size);
+    _index_free();
+    if (_index_map(stamp)) {
+        free(index);
+    } else {
+        _index = index;
+        _index_size = size;
+        _index_mapped = False;
+    }
+}
+
+
+/* Open the index, or build it if missing, or made for other themes; if
+ * it has not been checked for a while, also if older than any directory
+ * walked.  Its file time tells every process when it was last checked */
+static void _index_open(void)
+{
+    theme_root_td roots[THEME_MAX_ROOTS];
+    char path[MAX_PATH_LENGTH];
+    uint64_t stamp;
+
+    _roots_get(roots, THEME_MAX_ROOTS, &stamp);
+    if (!_index_map(stamp)) {
+        _index_build();
+        return;
+    }
+
+    time_t now = time(NULL);
+    if (now >= _index_time && now - _index_time < THEME_CHECK_INTERVAL) {
+        return;
+    }
+    if (!_index_fresh()) {
+        _index_build();
+    } else if (_index_path(path, sizeof(path), False) == 0) {
+        utimensat(AT_FDCWD, path, NULL, 0);
+        _index_time = now;
+    }
+}
+
+
+/* Look for an icon by name */
+Bool theme_lookup(const char *name, unsigned int size,
+        char *path, size_t length)
+{
+    theme_header_td header;
+
+    if (_stale) {
+        _stale = False;
+        _index_build();
+    } else if (!_index) {
+        _index_open();
+    }
+    if (!_index) {
+        return False;
+    }
+
+    memcpy(&header, _index, sizeof(header));
+    const uint32_t *buckets = (const uint32_t *) (_index + sizeof(header));
+    const theme_entry_td *entries = _index_entries(&header);
+    const char *strings = (const char *) (entries + header.entry_count);
+    uint32_t hash = _name_hash(name);
+
+    /* Best: lowest rank; then the closest larger size, the closest
+     * smaller one, and last the files of unknown size */
+    const theme_entry_td *best = NULL;
+    unsigned long best_score = 0;
+    for (uint32_t i = buckets[hash & (header.bucket_count - 1)];
+            i > 0 && i <= header.entry_count; i = entries[i - 1].next) {
+        const theme_entry_td *entry = &entries[i - 1];
+        if (entry->hash != hash || entry->name >= header.strings_size ||
+                entry->path >= header.strings_size ||
+                strcasecmp(strings + entry->name, name) != 0) {
+            continue;
+        }
+        unsigned long distance =
+            (entry->size == 0) ? 2ul << 16 :
+            (entry->size >= size) ? entry->size - size :
+            (1ul << 16) + size - entry->size;
+        unsigned long score = ((unsigned long) entry->rank << 20) +
+            distance;
+        if (!best || score < best_score) {
+            best = entry;
+            best_score = score;
+        }
+    }
+    if (!best) {
+        return False;
+    }
+
+    int written = snprintf(path, length, "%s", strings + best->path);
+    return written >= 0 && (size_t) written < length;
+}
+
+
+/* Watch the theme directories for changes */
+int theme_watch(void)
+{
+    if (_watch_fd < 0) {
+        _watch_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if (_watch_fd < 0) {
+            return -1;
+        }
+        /* Walk again, watching every directory on the way */
+        _stale = False;
+        _index_build();
+    }
+
+    return _watch_fd;
+}
+
+
+/* Take the changes of the theme directories */
+void theme_changed(void)
+{
+    char events[4096];
+
+    while (read(_watch_fd, events, sizeof(events)) > 0) {
+        /* Drain them; which directory changed does not matter */
+    }
+    _stale = True;
+}
+
+
+/* Release the index, and stop watching */
+void theme_release(void)
+{
+    _index_free();
+    if (_watch_fd >= 0) {
+        close(_watch_fd);
+        _watch_fd = -1;
+    }
+    _stale = False;
+}
@@ -0,0 +1,334 @@
+/**
+ * @file trace.c
+ *
+ * @brief Requests, round trips, flushes and time of every phase
+ *        implementation
+ */
+/*
+ * ISC License
+ * Copyright (c) 2025, J. A. Corbal <jacorbal@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS.  IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS
+ * ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF
+ * THIS SOFTWARE.
+ */
+
+/* Enable features from the POSIX.1-2008 standard, and the next
+ * definition of a symbol, from GNU */
+#define _POSIX_C_SOURCE 200809L
+#define _GNU_SOURCE
+
+/* Standard library includes */
+#include <dlfcn.h>      /* dlsym, RTLD_DEFAULT, RTLD_NEXT */
+#include <signal.h>     /* sigaction, sig_atomic_t */
+#include <stdio.h>      /* FILE, fprintf, snprintf */
+#include <string.h>     /* memset */
+#include <time.h>       /* clock_gettime, timespec */
+
+/* X includes */
+#include <X11/Xlib.h>       /* Display, LASTEvent, NextRequest, X* */
+#include <X11/Xlibint.h>    /* XESetBeforeFlush, xReply, _XReply */
+
+/* Local includes */
+#include <trace.h>
+#include <upload.h>
+
+
+/* Names of the phases, as printed */
+static const char *_phase_names[TRACE_PHASES] = {
+    "init", "load", "create", "draw", "event", "restore"
+};
+
+/* Names of the core event types; 0 stands for extension events */
+static const char *_event_names[LASTEvent] = {
+    "Extension", "Reply", "KeyPress", "KeyRelease", "ButtonPress",
+    "ButtonRelease", "MotionNotify", "EnterNotify", "LeaveNotify",
+    "FocusIn", "FocusOut", "KeymapNotify", "Expose", "GraphicsExpose",
+    "NoExpose", "VisibilityNotify", "CreateNotify", "DestroyNotify",
+    "UnmapNotify", "MapNotify", "MapRequest", "ReparentNotify",
+    "ConfigureNotify", "ConfigureRequest", "GravityNotify",
+    "ResizeRequest", "CirculateNotify", "CirculateRequest",
+    "PropertyNotify", "SelectionClear", "SelectionRequest",
+    "SelectionNotify", "ColormapNotify", "ClientMessage", "MappingNotify",
+    "GenericEvent"
+};
+
+/* Totals of every phase and of every event type */
+static trace_stats_td _phases[TRACE_PHASES];
+static trace_stats_td _events[LASTEvent];
+
+/* Connection counters, kept by the flush hook of the display, and by
+ * the reply wrapper */
+static Display *_display = NULL;
+static unsigned long long _round_trips = 0;
+static unsigned long long _flushes = 0;
+static unsigned long long _bytes = 0;
+
+/* Reply function of Xlib, and whether Xlib calls the wrapper instead */
+static Status (*_reply_next)(Display *, xReply *, int, Bool) = NULL;
+static Bool _reply_wrapped = False;
+
+/* Set when the totals have to be dumped */
+static volatile sig_atomic_t _dump = 0;
+
+
+/* Current monotonic time (us) */
+static long long _now(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (long long) now.tv_sec * 1000000 + now.tv_nsec / 1000;
+}
+
+
+/* Wait for the reply of a request, as Xlib does, and count it; every
+ * request with a reply goes through here, so it counts no event read
+ * and no request without a reply.  Defined in the executable, it takes
+ * the place of the one of a shared Xlib, which calls it too */
+Status _XReply(Display *display, xReply *reply, int extra, Bool discard)
+{
+    if (!_reply_next) {
+        *(void **) &_reply_next = dlsym(RTLD_NEXT, "_XReply");
+        if (!_reply_next) {
+            return 0;
+        }
+    }
+    if (display == _display) {
+        ++_round_trips;     /* The display is locked meanwhile */
+    }
+
+    return _reply_next(display, reply, extra, discard);
+}
+
+
+/* Count every write to the connection */
+static void _flush_hook(Display *display, XExtCodes *codes,
+        const char *data, long length)
+{
+    (void) codes;
+    (void) data;
+
+    (void) display;
+    if (length <= 0) {
+        return;
+    }
+    ++_flushes;
+    _bytes += (unsigned long long) length;
+}
+
+
+/* Forget the display once it is closed */
+static int _close_hook(Display *display, XExtCodes *codes)
+{
+    (void) codes;
+
+    if (display == _display) {
+        _display = NULL;
+    }
+
+    return 0;
+}
+
+
+/* Hook the flushes of a display, once */
+static void _hook_install(Display *display)
+{
+    XExtCodes *codes = XAddExtension(display);
+    if (!codes) {
+        return;
+    }
+    XESetBeforeFlush(display, codes->extension, _flush_hook);
+    XESetCloseDisplay(display, codes->extension, _close_hook);
+    _display = display;
+
+    /* Whether Xlib finds the wrapper first */
+    Status (*reply)(Display *, xReply *, int, Bool);
+    *(void **) &reply = dlsym(RTLD_DEFAULT, "_XReply");
+    _reply_wrapped = (reply == _XReply);
+}
+
+
+/* Start a phase */
+void trace_begin(trace_span_td *span, Display *display,
+        trace_phase_td phase)
+{
+    XLockDisplay(display);
+    if (display != _display) {
+        _hook_install(display);
+    }
+    span->display = display;
+    span->phase = phase;
+    span->request = NextRequest(display);
+    span->round_trips = _round_trips;
+    span->flushes = _flushes;
+    span->bytes = _bytes;
+    XUnlockDisplay(display);
+    span->start = _now();
+}
+
+
+/* Add a finished phase to some totals */
+static void _stats_add(trace_stats_td *stats, const trace_span_td *span,
+        long long time)
+{
+    stats->calls++;
+    stats->requests += NextRequest(span->display) - span->request;
+    stats->round_trips += _round_trips - span->round_trips;
+    stats->flushes += _flushes - span->flushes;
+    stats->bytes += _bytes - span->bytes;
+    stats->time += time;
+    if (time > stats->time_max) {
+        stats->time_max = time;
+    }
+}
+
+
+/* End a phase, and add it to its totals */
+void trace_end(trace_span_td *span)
+{
+    long long time = _now() - span->start;
+
+    XLockDisplay(span->display);
+    _stats_add(&_phases[span->phase], span, time);
+    XUnlockDisplay(span->display);
+}
+
+
+/* End the handling of an event, and add it to its totals */
+void trace_end_event(trace_span_td *span, int type)
+{
+    long long time = _now() - span->start;
+
+    XLockDisplay(span->display);
+    _stats_add(&_phases[span->phase], span, time);
+    _stats_add(&_events[(type > 0 && type < LASTEvent) ? type : 0],
+            span, time);
+    XUnlockDisplay(span->display);
+}
+
+
+/* Count a round trip that Xlib does not see */
+void trace_round_trip(Display *display)
+{
+    XLockDisplay(display);
+    if (display == _display) {
+        ++_round_trips;
+    }
+    XUnlockDisplay(display);
+}
+
+
+/* Whether round trips are counted */
+Bool trace_round_trips_counted(void)
+{
+    return _reply_wrapped;
+}
+
+
+/* Get the totals of a phase */
+const trace_stats_td *trace_stats(trace_phase_td phase)
+{
+    return &_phases[phase];
+}
+
+
+/* Print the totals of every phase that was run */
+void trace_print(FILE *fp)
+{
+    fprintf(fp, "%-8s %7s %10s %9s %9s %7s %7s %10s\n", "phase",
+            "calls", "time(ms)", "max(ms)", "requests", "trips",
+            "flushes", "bytes");
+    for (int i = 0; i < TRACE_PHASES; ++i) {
+        const trace_stats_td *stats = &_phases[i];
+        char trips[24] = "-";   /* Not counted by this build */
+        if (stats->calls == 0) {
+            continue;
+        }
+        if (_reply_wrapped) {
+            snprintf(trips, sizeof(trips), "%llu", stats->round_trips);
+        }
+        fprintf(fp, "%-8s %7lu %10.3f %9.3f %9llu %7s %7llu %10llu\n",
+                _phase_names[i], stats->calls, (double) stats->time / 1e3,
+                (double) stats->time_max / 1e3, stats->requests, trips,
+                stats->flushes, stats->bytes);
+    }
+}
+
+
+/* Print some totals as a JSON object */
+static void _stats_print_json(FILE *fp, const char *name,
+        const trace_stats_td *stats, Bool first)
+{
+    fprintf(fp, "%s\n    \"%s\": {\"calls\": %lu, \"requests\": %llu, "
+            "\"round_trips\": %llu, \"flushes\": %llu, \"bytes\": %llu, "
+            "\"time_us\": %lld, \"max_us\": %lld}",
+            (first) ? "" : ",", name, stats->calls, stats->requests,
+            stats->round_trips, stats->flushes, stats->bytes,
+            stats->time, stats->time_max);
+}
+
+
+/* Print the totals of every phase and event type as JSON */
+void trace_print_json(FILE *fp)
+{
+    const upload_stats_td *uploads = upload_stats();
+    Bool first = True;
+
+    fprintf(fp, "{\n  \"round_trips_counted\": %s,\n  \"phases\": {",
+            (_reply_wrapped) ? "true" : "false");
+    for (int i = 0; i < TRACE_PHASES; ++i) {
+        _stats_print_json(fp, _phase_names[i], &_phases[i], i == 0);
+    }
+    fprintf(fp, "\n  },\n  \"events\": {");
+    for (int i = 0; i < LASTEvent; ++i) {
+        if (_events[i].calls > 0) {
+            _stats_print_json(fp, _event_names[i], &_events[i], first);
+            first = False;
+        }
+    }
+    fprintf(fp, "\n  },\n  \"uploads\": {\"shm_bytes\": %llu, "
+            "\"shm_count\": %lu, \"socket_bytes\": %llu, "
+            "\"socket_count\": %lu}\n}\n",
+            uploads->shm_bytes, uploads->shm_count,
+            uploads->socket_bytes, uploads->socket_count);
+    fflush(fp);
+}
+
+
+/* Signal handler to dump the totals */
+static void _dump_set(int signum)
+{
+    (void) signum;
+    _dump = 1;
+}
+
+
+/* Dump the totals as JSON whenever a signal is received */
+void trace_dump_install(int signum)
+{
+    struct sigaction action;
+
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = _dump_set;
+    sigaction(signum, &action, NULL);
+}
+
+
+/* Print the totals as JSON, if the signal was received */
+void trace_dump_pending(FILE *fp)
+{
+    if (_dump) {
+        _dump = 0;
+        trace_print_json(fp);
+    }
+}
@@ -0,0 +1,317 @@
+/**
+ * @file upload.c
+ *
+ * @brief Image uploads through MIT-SHM, or through the socket
+ *        implementation
+ */
+/*
+ * ISC License
+ * Copyright (c) 2025, J. A. Corbal <jacorbal@gmail.com>
+ *
+ * Permission to use, copy, modify, and/or distribute this software for
+ * any purpose with or without fee is hereby granted, provided that the
+ * above copyright notice and this permission notice appear in all copies.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL
+ * WARRANTIES WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS.  IN NO EVENT SHALL THE
+ * AUTHOR BE LIABLE FOR ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL
+ * DAMAGES OR ANY DAMAGES WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR
+ * PROFITS, WHETHER IN AN ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS
+ * ACTION, ARISING OUT OF OR IN CONNECTION WITH THE USE OR PERFORMANCE OF
+ * THIS SOFTWARE.
+ */
+
+/* Enable features from the POSIX.1-2008 standard */
+#define _POSIX_C_SOURCE 200809L
+
+/* Standard library includes */
+#include <stdio.h>      /* FILE, fprintf */
+#include <string.h>     /* memcpy */
+#include <sys/ipc.h>    /* IPC_CREAT, IPC_PRIVATE, IPC_RMID */
+#include <sys/shm.h>    /* shmat, shmctl, shmdt, shmget */
+
+/* X includes */
+#include <X11/Xlib.h>               /* Display, Drawable, GC, XImage */
+#include <X11/Xutil.h>              /* XDestroyImage */
+#include <X11/extensions/XShm.h>    /* XShm*, XShmSegmentInfo */
+
+/* Local includes */
+#include <upload.h>
+
+
+/* Number of shared segments kept */
+#define UPLOAD_POOL_SIZE (4)
+
+/* Smaller uploads go through the socket; copying them is cheaper than
+ * keeping track of a segment (bytes) */
+#define UPLOAD_MIN_BYTES (16384)
+
+/* Smallest segment: a 128x128 icon at 32 bits per pixel (bytes) */
+#define UPLOAD_MIN_SEGMENT (65536)
+
+
+/**
+ * @typedef segment_td
+ *
+ * @brief Shared memory segment attached by the server
+ */
+typedef struct {
+    XShmSegmentInfo info;   /**< Segment, as the server knows it */
+    size_t size;            /**< Size (bytes) */
+    unsigned long serial;   /**< Last request that used it */
+} segment_td;
+
+
+/* Display the pool is for, and whether MIT-SHM works on it: 1 if it
+ * does, -1 if it does not, 0 if not known yet */
+static Display *_upload_display = NULL;
+static int _upload_state = 0;
+
+/* Pool of segments, and statistics */
+static segment_td _pool[UPLOAD_POOL_SIZE];
+static unsigned int _pool_count = 0;
+static upload_stats_td _stats;
+
+/* Set by the error handler while attaching a segment */
+static volatile Bool _attach_failed = False;
+
+
+/* Error handler while attaching; a remote server cannot attach */
+static int _error_attach(Display *display, XErrorEvent *error)
+{
+    (void) display;
+    (void) error;
+    _attach_failed = True;
+    return 0;
+}
+
+
+/* Whether MIT-SHM may be used on a display */
+static Bool _upload_available(Display *display)
+{
+    if (display != _upload_display) {
+        _upload_display = display;
+        _pool_count = 0;
+        _upload_state = XShmQueryExtension(display) ? 0 : -1;
+    }
+
+    return _upload_state >= 0;
+}
+
+
+/* Create and attach a segment; the first failure disables MIT-SHM */
+static Bool _segment_create(Display *display, segment_td *segment,
+        size_t size)
+{
+    segment->info.shmid = shmget(IPC_PRIVATE, size, IPC_CREAT | 0600);
+    if (segment->info.shmid < 0) {
+        return False;
+    }
+    segment->info.shmaddr = shmat(segment->info.shmid, NULL, 0);
+    if (segment->info.shmaddr == (char *) -1) {
+        shmctl(segment->info.shmid, IPC_RMID, NULL);
+        return False;
+    }
+    segment->info.readOnly = True;  /* The server only reads it */
+
+    /* Attaching fails if the server is in another host, even if it has
+     * the extension (e.g., forwarded through SSH) */
+    _attach_failed = False;
+    int (*handler)(Display *, XErrorEvent *) =
+        XSetErrorHandler(_error_attach);
+    XShmAttach(display, &segment->info);
+    XSync(display, False);
+    XSetErrorHandler(handler);
+
+    /* Removed as soon as both ends detach it, even after a crash */
+    shmctl(segment->info.shmid, IPC_RMID, NULL);
+    if (_attach_failed) {
+        shmdt(segment->info.shmaddr);
+        _upload_state = -1;
+        return False;
+    }
+
+    _upload_state = 1;
+    segment->size = size;
+    segment->serial = 0;
+
+    return True;
+}
+
+
+/* Detach and release a segment */
+static void _segment_destroy(Display *display, segment_td *segment)
+{
+    XShmDetach(display, &segment->info);
+    shmdt(segment->info.shmaddr);
+}
+
+
+/* Smallest segment of at least a size the server is done with */
+static segment_td *_segment_free(Display *display, size_t size)
+{
+    unsigned long processed = LastKnownRequestProcessed(display);
+    segment_td *best = NULL;
+
+    for (unsigned int i = 0; i < _pool_count; ++i) {
+        if (_pool[i].size >= size && _pool[i].serial <= processed &&
+                (!best || _pool[i].size < best->size)) {
+            best = &_pool[i];
+        }
+    }
+
+    return best;
+}
+
+
+/* Get a segment of at least a size, free to be written */
+static segment_td *_segment_get(Display *display, size_t size)
+{
+    segment_td *segment = _segment_free(display, size);
+    if (segment) {
+        return segment;
+    }
+
+    /* Sizes go by powers of two, so that close sizes share segments */
+    size_t class = UPLOAD_MIN_SEGMENT;
+    while (class < size) {
+        class *= 2;
+    }
+
+    /* A new segment, while the pool is not full */
+    if (_pool_count < UPLOAD_POOL_SIZE) {
+        if (!_segment_create(display, &_pool[_pool_count], class)) {
+            return NULL;
+        }
+        return &_pool[_pool_count++];
+    }
+
+    /* Wait for the server to be done with every segment, and replace
+     * the smallest one if none is large enough */
+    XSync(display, False);
+    segment = _segment_free(display, size);
+    if (!segment) {
+        segment = &_pool[0];
+        for (unsigned int i = 1; i < _pool_count; ++i) {
+            if (_pool[i].size < segment->size) {
+                segment = &_pool[i];
+            }
+        }
+        _segment_destroy(display, segment);
+        if (!_segment_create(display, segment, class)) {
+            *segment = _pool[--_pool_count];
+            return NULL;
+        }
+    }
+
+    return segment;
+}
+
+
+/* Upload through a shared segment; false if it cannot be done */
+static Bool _upload_shm(Display *display, Drawable drawable, GC gc,
+        XImage *image, int src_x, int src_y, int dst_x, int dst_y,
+        unsigned int width, unsigned int height)
+{
+    int screen = DefaultScreen(display);
+
+    XImage *shared = XShmCreateImage(display, DefaultVisual(display,
+                screen), (unsigned int) image->depth, ZPixmap, NULL,
+            NULL, width, height);
+    if (!shared) {
+        return False;
+    }
+    size_t size = (size_t) shared->bytes_per_line * height;
+    segment_td *segment = NULL;
+    if (shared->bits_per_pixel == image->bits_per_pixel &&
+            shared->byte_order == image->byte_order) {
+        segment = _segment_get(display, size);
+    }
+    if (!segment) {
+        XDestroyImage(shared);
+        return False;
+    }
+    shared->obdata = (char *) &segment->info;
+    shared->data = segment->info.shmaddr;
+
+    /* A single copy, straight where the server reads it */
+    size_t row = (size_t) width * (size_t) image->bits_per_pixel / 8;
+    const char *src = image->data +
+        (size_t) src_y * (size_t) image->bytes_per_line +
+        (size_t) src_x * (size_t) image->bits_per_pixel / 8;
+    for (unsigned int y = 0; y < height; ++y) {
+        memcpy(shared->data + (size_t) y * (size_t) shared->bytes_per_line,
+                src + (size_t) y * (size_t) image->bytes_per_line, row);
+    }
+
+    segment->serial = NextRequest(display);
+    XShmPutImage(display, drawable, gc, shared, 0, 0, dst_x, dst_y,
+            width, height, False);
+    XDestroyImage(shared);  /* Only the image, not its segment */
+
+    _stats.shm_bytes += size;
+    ++_stats.shm_count;
+
+    return True;
+}
+
+
+/* Upload a rectangle of an image into a drawable */
+void upload_image(Display *display, Drawable drawable, GC gc,
+        XImage *image, int src_x, int src_y, int dst_x, int dst_y,
+        unsigned int width, unsigned int height)
+{
+    size_t bytes = ((size_t) width * (size_t) image->bits_per_pixel + 7) /
+        8 * height;
+
+    if (bytes >= UPLOAD_MIN_BYTES && image->format == ZPixmap &&
+            image->bits_per_pixel % 8 == 0 &&
+            image->byte_order == ImageByteOrder(display) &&
+            _upload_available(display) &&
+            _upload_shm(display, drawable, gc, image, src_x, src_y,
+                dst_x, dst_y, width, height)) {
+        return;
+    }
+
+    XPutImage(display, drawable, gc, image, src_x, src_y, dst_x, dst_y,
+            width, height);
+    _stats.socket_bytes += bytes;
+    ++_stats.socket_count;
+}
+
+
+/* Release the shared memory segments of a display */
+void upload_release(Display *display)
+{
+    if (display != _upload_display) {
+        return;
+    }
+
+    /* The server must be done with them before detaching */
+    if (_pool_count > 0) {
+        XSync(display, False);
+    }
+    for (unsigned int i = 0; i < _pool_count; ++i) {
+        _segment_destroy(display, &_pool[i]);
+    }
+    _pool_count = 0;
+    _upload_display = NULL;
+}
+
+
+/* Get the bytes uploaded by every path */
+const upload_stats_td *upload_stats(void)
+{
+    return &_stats;
+}
+
+
+/* Print the bytes uploaded by every path, in a single line */
+void upload_stats_print(FILE *fp)
+{
+    fprintf(fp, "Uploaded %llu bytes in %lu images through MIT-SHM, "
+            "%llu bytes in %lu images through the socket\n",
+            _stats.shm_bytes, _stats.shm_count,
+            _stats.socket_bytes, _stats.socket_count);
+}